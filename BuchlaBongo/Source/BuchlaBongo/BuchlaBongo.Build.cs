@@ -42,6 +42,7 @@ public class BuchlaBongo : ModuleRules
                 "Slate",
                 "SlateCore",
                 "SignalProcessing",
+                "Projects",
 				// ... add private dependencies that you statically link with here ...	
 			}
             );
@@ -2,19 +2,48 @@
 
 #include "BuchlaBongo.h"
 #include "MetasoundFrontendRegistries.h"
+#include "BuchlaBongoStats.h"
+#include "BuchlaBongoAllocations.h"
+#include "BuchlaLowPassGateHitCache.h"
 
 #define LOCTEXT_NAMESPACE "FBuchlaBongoModule"
 
+DEFINE_LOG_CATEGORY(LogBuchlaBongo);
+
+DEFINE_STAT(STAT_BuchlaBongo_LPGExecute);
+DEFINE_STAT(STAT_BuchlaBongo_LPGEnvelope);
+DEFINE_STAT(STAT_BuchlaBongo_LPGFilterUpdate);
+DEFINE_STAT(STAT_BuchlaBongo_LPGMultichannelExecute);
+DEFINE_STAT(STAT_BuchlaBongo_VoiceBankExecute);
+DEFINE_STAT(STAT_BuchlaBongo_BongoExecute);
+DEFINE_STAT(STAT_BuchlaBongo_CoefficientUpdates);
+DEFINE_STAT(STAT_BuchlaBongo_Triggers);
+DEFINE_STAT(STAT_BuchlaBongo_CulledGates);
+DEFINE_STAT(STAT_BuchlaBongo_ActiveGates);
+DEFINE_STAT(STAT_BuchlaBongo_SleepingGates);
+
+CSV_DEFINE_CATEGORY(BuchlaBongo, true);
+
 void FBuchlaBongoModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+	//Before any node is registered, so no gate can be rendering yet while GMalloc is swapped
+	Metasound::BuchlaBongoAllocations::InstallProxy();
 	FMetasoundFrontendRegistryContainer::Get()->RegisterPendingNodes();
+
+	HitCacheTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float)
+	{
+		Metasound::FLowPassGateHitCache::Get().CollectRetired();
+		return true;
+	}), 1.0f);
 }
 
 void FBuchlaBongoModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FTSTicker::GetCoreTicker().RemoveTicker(HitCacheTickerHandle);
+	Metasound::BuchlaBongoAllocations::RemoveProxy();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,155 @@
+#include "BuchlaBongoAllocations.h"
+#include "BuchlaBongo.h"
+#include "HAL/MemoryBase.h"
+
+namespace Metasound
+{
+	namespace BuchlaBongoAllocations
+	{
+		//Per thread so the proxy never needs a lock or an atomic on the allocation path
+		static thread_local int32 RenderScopeDepth = 0;
+		static thread_local int32 ThreadRenderAllocations = 0;
+
+		static std::atomic<int32> NumRenderAllocations{ 0 };
+		//Open FScopedAllocationTracking scopes, the proxy only counts while this is above 0
+		static std::atomic<int32> NumTrackingScopes{ 0 };
+
+		//Forwards everything to the allocator it was put in front of, counting the allocations made inside a render scope
+		class FCountingMalloc final : public FMalloc
+		{
+		public:
+			explicit FCountingMalloc(FMalloc* InInner) : Inner(InInner) {}
+
+			FMalloc* GetInner() const { return Inner; }
+
+			virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+			{
+				CountAllocation();
+				return Inner->Malloc(Count, Alignment);
+			}
+
+			virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+			{
+				CountAllocation();
+				return Inner->TryMalloc(Count, Alignment);
+			}
+
+			virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+			{
+				//A realloc to 0 bytes is a free
+				if (Count > 0)
+				{
+					CountAllocation();
+				}
+				return Inner->Realloc(Original, Count, Alignment);
+			}
+
+			virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+			{
+				if (Count > 0)
+				{
+					CountAllocation();
+				}
+				return Inner->TryRealloc(Original, Count, Alignment);
+			}
+
+			virtual void Free(void* Original) override { Inner->Free(Original); }
+			virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+			virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+			virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+			virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+			virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+			virtual void InitializeStatsMetadata() override { Inner->InitializeStatsMetadata(); }
+			virtual void UpdateStats() override { Inner->UpdateStats(); }
+			virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+			virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+			virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+			virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+			virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+		private:
+			static FORCEINLINE void CountAllocation()
+			{
+				if (RenderScopeDepth > 0 && NumTrackingScopes.load(std::memory_order_relaxed) > 0)
+				{
+					++ThreadRenderAllocations;
+				}
+			}
+
+			FMalloc* Inner;
+		};
+
+		//Never destroyed, memory allocated through it can still be freed through it after it is taken out of GMalloc
+		static FCountingMalloc* Proxy = nullptr;
+
+		void InstallProxy()
+		{
+#if BUCHLABONGO_RENDER_ALLOCATION_CHECKS
+			if (Proxy == nullptr)
+			{
+				Proxy = new FCountingMalloc(GMalloc);
+				GMalloc = Proxy;
+			}
+#endif
+		}
+
+		void RemoveProxy()
+		{
+#if BUCHLABONGO_RENDER_ALLOCATION_CHECKS
+			//The proxy's code unloads with the module, so it has to come out of GMalloc first
+			//Something else wrapped GMalloc after it, taking the proxy out from under that is not possible
+			if (Proxy != nullptr && GMalloc == Proxy)
+			{
+				GMalloc = Proxy->GetInner();
+			}
+			else if (Proxy != nullptr)
+			{
+				UE_LOG(LogBuchlaBongo, Warning, TEXT("GMalloc was wrapped after the render allocation proxy, the proxy is left in place"));
+			}
+#endif
+		}
+
+		int32 GetNumRenderAllocations()
+		{
+			return NumRenderAllocations.load(std::memory_order_relaxed);
+		}
+
+		bool IsTracking()
+		{
+			return Proxy != nullptr && NumTrackingScopes.load(std::memory_order_relaxed) > 0;
+		}
+
+		FScopedAllocationTracking::FScopedAllocationTracking()
+		{
+			NumTrackingScopes.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		FScopedAllocationTracking::~FScopedAllocationTracking()
+		{
+			NumTrackingScopes.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+		FRenderScope::FRenderScope(const TCHAR* InOwner)
+			: Owner(InOwner)
+			, StartCount(ThreadRenderAllocations)
+		{
+			++RenderScopeDepth;
+		}
+
+		FRenderScope::~FRenderScope()
+		{
+			if (--RenderScopeDepth > 0)
+			{
+				return;
+			}
+
+			//Reported after the scope is closed, the ensure itself allocates
+			const int32 NumAllocations = ThreadRenderAllocations - StartCount;
+			if (NumAllocations > 0)
+			{
+				NumRenderAllocations.fetch_add(NumAllocations, std::memory_order_relaxed);
+				ensureMsgf(false, TEXT("%s allocated %d times on the audio render thread"), Owner, NumAllocations);
+			}
+		}
+	}
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+//Verifies in non-shipping builds that Execute() never allocates on the audio render thread
+#ifndef BUCHLABONGO_RENDER_ALLOCATION_CHECKS
+#define BUCHLABONGO_RENDER_ALLOCATION_CHECKS !UE_BUILD_SHIPPING
+#endif
+
+namespace Metasound
+{
+	//Counts real heap allocations made inside the render scopes of the plugin's operators
+	//The counting proxy sits in front of GMalloc from module startup on, nothing is counted unless a FScopedAllocationTracking is alive
+	namespace BuchlaBongoAllocations
+	{
+		//Called by the module, swapping GMalloc is only safe while nothing else can be rendering
+		//Both are no-ops unless BUCHLABONGO_RENDER_ALLOCATION_CHECKS is set
+		void InstallProxy();
+		void RemoveProxy();
+
+		//Allocations made inside any FRenderScope since the first tracking scope was opened
+		BUCHLABONGO_API int32 GetNumRenderAllocations();
+		BUCHLABONGO_API bool IsTracking();
+
+		//Counts render allocations for its lifetime, for benchmarks and tests only
+		//Only flips a flag the proxy reads, so it can be opened while other threads allocate, scopes may nest
+		class BUCHLABONGO_API FScopedAllocationTracking
+		{
+		public:
+			FScopedAllocationTracking();
+			~FScopedAllocationTracking();
+
+			FScopedAllocationTracking(const FScopedAllocationTracking&) = delete;
+			FScopedAllocationTracking& operator=(const FScopedAllocationTracking&) = delete;
+		};
+
+		//Marks the calling thread as rendering, only the outermost scope on a thread reports
+		//Raises an ensure naming InOwner when anything was allocated inside it
+		class BUCHLABONGO_API FRenderScope
+		{
+		public:
+			explicit FRenderScope(const TCHAR* InOwner);
+			~FRenderScope();
+
+			FRenderScope(const FRenderScope&) = delete;
+			FRenderScope& operator=(const FRenderScope&) = delete;
+
+		private:
+			const TCHAR* Owner;
+			int32 StartCount;
+		};
+	}
+}
@@ -0,0 +1,49 @@
+#include "BuchlaBongoCVars.h"
+#include "HAL/IConsoleManager.h"
+
+namespace Metasound
+{
+	namespace BuchlaBongoCVars
+	{
+		static int32 EnvelopeControlRateCVar = 1;
+		static FAutoConsoleVariableRef CVarEnvelopeControlRate(
+			TEXT("au.BuchlaBongo.EnvelopeControlRate"),
+			EnvelopeControlRateCVar,
+			TEXT("Samples between exact envelope evaluations, the envelope is interpolated linearly in between.\n")
+			TEXT("1: every sample (default), 8, 16 or 32 trade envelope precision for CPU. Other values round down to a power of two."),
+			ECVF_Default);
+
+		//Also settable from [SystemSettings] in DefaultEngine.ini, e.g. au.BuchlaBongo.CpuBudget=0.1
+		static float CpuBudgetCVar = 0.0f;
+		static FAutoConsoleVariableRef CVarCpuBudget(
+			TEXT("au.BuchlaBongo.CpuBudget"),
+			CpuBudgetCVar,
+			TEXT("Share of real time all Buchla Low Pass Gates and Buchla Bongos together may spend rendering, 0.1 is a tenth of one core.\n")
+			TEXT("0: no budget (default). Over budget the gates degrade step by step, see au.BuchlaBongo.MaxDegradation."),
+			ECVF_Default);
+
+		static int32 MaxDegradationCVar = 3;
+		static FAutoConsoleVariableRef CVarMaxDegradation(
+			TEXT("au.BuchlaBongo.MaxDegradation"),
+			MaxDegradationCVar,
+			TEXT("Furthest step the CPU budget may take the Buchla Low Pass Gates to.\n")
+			TEXT("0: never degrade, 1: control rate envelope, 2: also no oversampling, 3: also release the quietest ranked voices (default)."),
+			ECVF_Default);
+
+		int32 GetEnvelopeControlRate()
+		{
+			const int32 ControlRate = FMath::Clamp(EnvelopeControlRateCVar, 1, 32);
+			return 1 << FMath::FloorLog2(ControlRate);
+		}
+
+		float GetCpuBudget()
+		{
+			return FMath::Max(0.0f, CpuBudgetCVar);
+		}
+
+		int32 GetMaxDegradation()
+		{
+			return FMath::Clamp(MaxDegradationCVar, 0, 3);
+		}
+	}
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace Metasound
+{
+	//Console variables shared by the plugin's nodes, set them per platform through device profiles
+	namespace BuchlaBongoCVars
+	{
+		//au.BuchlaBongo.EnvelopeControlRate as a power of two between 1 and 32, safe to call from the audio render thread
+		int32 GetEnvelopeControlRate();
+		//au.BuchlaBongo.CpuBudget, the share of real time all Buchla Low Pass Gates and Bongos together may use, 0 when there is no budget
+		float GetCpuBudget();
+		//au.BuchlaBongo.MaxDegradation, how far the gates may be degraded to stay within the budget, 0 to 3
+		int32 GetMaxDegradation();
+	}
+}
@@ -0,0 +1,592 @@
+#include "Internationalization/Text.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundNodeRegistrationMacro.h"
+#include "MetasoundParamHelper.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundStandardNodesNames.h"
+#include "MetasoundTrigger.h"
+#include "MetasoundTime.h"
+#include "MetasoundAudioBuffer.h"
+#include "MetasoundStandardNodesCategories.h"
+#include "MetasoundFacade.h"
+#include "BuchlaEnvelope.h"
+#include "BuchlaLowPassGateDSP.h"
+#include "BuchlaLowPassGateBudget.h"
+#include "BuchlaBongoAllocations.h"
+#include "DSP/FloatArrayMath.h"
+#include "Misc/ScopeExit.h"
+#include "Misc/EngineVersionComparison.h"
+#include "BuchlaBongoStats.h"
+#include "BuchlaBongoCVars.h"
+
+#define LOCTEXT_NAMESPACE "BuchlaBongo_Bongo"
+
+namespace Metasound
+{
+	namespace BuchlaBongoNode
+	{
+		METASOUND_PARAM(InputTrigger, "Trigger", "Strikes the bongo");
+		METASOUND_PARAM(InputFrequency, "Frequency", "Pitch of the drum body in Hz");
+		METASOUND_PARAM(InputPitchDrop, "Pitch Drop", "How far above Frequency the body starts when struck, in semitones");
+		METASOUND_PARAM(InputPitchDecay, "Pitch Decay", "How quickly the body falls back to Frequency after a strike");
+		METASOUND_PARAM(InputClickLevel, "Click Level", "Level of the noise click at the start of each strike");
+		METASOUND_PARAM(InputAttackTime, "Attack Time", "The attack time of the envelope");
+		METASOUND_PARAM(InputDecayTime, "Decay Time", "The decay time of the envelope");
+		METASOUND_PARAM(InputAttackCurve, "Attack Curve", "1.0 = linear growth, <1.0 = logorithmic growth, >1.0 = exponential growth");
+		METASOUND_PARAM(InputDecayCurve, "Decay Curve", "1.0 = linear decay, <1.0 = exponential decay, >1.0 = logorithmic decay");
+		METASOUND_PARAM(InputCutOff, "Cut Off", "Cut off frequency of the low pass gate");
+		METASOUND_PARAM(InputVactrol, "Vactrol", "Use the vactrol model for the low pass gate instead of Both mode");
+
+		METASOUND_PARAM(OutputOnDone, "On Done", "Triggers when the strike has finished");
+		METASOUND_PARAM(OutputAudio, "Out", "Output Audio");
+
+		//Length of the noise click, short enough to read as the stick hitting the skin
+		constexpr float ClickTime = 0.003f;
+	}
+
+	//The whole MS_Bongo voice in one operator: a pitched body and a noise click into the low pass gate
+	//Both the excitation and the gate are rendered in the same per-sample loop, so no intermediate buffers leave the node
+	class FBuchlaBongoOperator : public TExecutableOperator<FBuchlaBongoOperator>
+	{
+	public:
+		static const FNodeClassMetadata& GetNodeInfo();
+		static const FVertexInterface& GetVertexInterface();
+		static TUniquePtr<IOperator> CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors);
+
+		FBuchlaBongoOperator(const FOperatorSettings& InSettings,
+			const FTriggerReadRef& InTriggerIn,
+			const FFloatReadRef& InFrequency,
+			const FFloatReadRef& InPitchDrop,
+			const FTimeReadRef& InPitchDecay,
+			const FFloatReadRef& InClickLevel,
+			const FTimeReadRef& InAttackTime,
+			const FTimeReadRef& InDecayTime,
+			const FFloatReadRef& InAttackCurveFactor,
+			const FFloatReadRef& InDecayCurveFactor,
+			const FFloatReadRef& InCutOff,
+			const FBoolReadRef& InUseVactrol);
+
+		virtual FDataReferenceCollection GetInputs() const override;
+		virtual FDataReferenceCollection GetOutputs() const override;
+
+		void Execute();
+
+		//Readies the operator for reuse at InSettings, the outputs keep their identity so existing bindings stay valid
+		void Reset(const FOperatorSettings& InSettings);
+#if !UE_VERSION_OLDER_THAN(5, 3, 0)
+		//Lets the engine pool and reuse the operator instead of rebuilding it for every new source
+		void Reset(const IOperator::FResetParams& InParams) { Reset(InParams.OperatorSettings); }
+#endif
+		//Puts the operator back into the state it was constructed in, shared by the constructor and Reset()
+		void ResetState(const FOperatorSettings& InSettings);
+
+	private:
+		void StartHit();
+		//Same change detection as the low pass gate's UpdateParams, curve changes ramp so a sounding strike does not jump
+		void UpdateEnvelope();
+		void UpdateFilter();
+		void RenderRange(int32 StartFrame, int32 EndFrame);
+		//Fades the block just rendered to silence and ends the strike, the voice is idle from the next block
+		void FastRelease();
+
+		template<bool bUseVactrol>
+		void RenderVoice(int32 StartFrame, int32 EndFrame);
+
+		FORCEINLINE float NextNoise()
+		{
+			NoiseSeed = NoiseSeed * 1664525u + 1013904223u;
+			return (float)(int32)NoiseSeed * (1.0f / 2147483648.0f);
+		}
+
+		FTriggerReadRef TriggerIn;
+		FFloatReadRef Frequency;
+		FFloatReadRef PitchDrop;
+		FTimeReadRef PitchDecay;
+		FFloatReadRef ClickLevel;
+		FTimeReadRef AttackTime;
+		FTimeReadRef DecayTime;
+		FFloatReadRef AttackCurveFactor;
+		FFloatReadRef DecayCurveFactor;
+		FFloatReadRef CutOffFrequency;
+		FBoolReadRef UseVactrol;
+
+		FTriggerWriteRef OnDone;
+		FAudioBufferWriteRef AudioOutput;
+
+		float SampleRate = 0.0f;
+		int32 NumFramesPerBlock = 0;
+		int32 ClickSampleCount = 1;
+
+		FEnvelopeState EnvelopeState;
+		FAudioBuffer EnvelopeBuffer;
+		TArray<int32> FinishedFrames;
+		float PreviousAttackTime = -1.0f;
+		float PreviousDecayTime = -1.0f;
+		float PreviousAttackCurve = -1.0f;
+		float PreviousDecayCurve = -1.0f;
+
+		LowPassGateDSP::FSVFCoefficients FilterCoefficients;
+		LowPassGateDSP::FSVFState FilterState;
+		TSharedRef<const LowPassGateDSP::FCutOffTable> CutOffTable;
+		TSharedRef<const LowPassGateDSP::FVactrolTable> VactrolTable;
+		float PreviousFrequency{ -1.f };
+		float GateGain = 0.0f;
+		float VactrolLevel = 0.0f;
+
+		//Excitation state, reset on every strike so each hit starts identically
+		float Phase = 0.0f;
+		float PitchEnvelope = 0.0f;
+		float PitchRange = 0.0f;
+		float PitchDecayCoefficient = 0.0f;
+		int32 ClickSamplesRemaining = 0;
+		uint32 NoiseSeed = 0;
+		//Pitch Drop and Pitch Decay as last worked out, a strike with the same inputs reuses them instead of calling Pow() and Exp()
+		float PreviousPitchDrop = -1.0f;
+		float PreviousPitchDecay = -1.0f;
+		float HitPitchRange = 0.0f;
+		float HitPitchDecayCoefficient = 0.0f;
+
+		//Each bongo is one voice of the same budget as the low pass gates
+		FLowPassGateBudgetVoice BudgetVoice;
+
+		bool bIsOutputCleared = false;
+		bool bIsCulled = false;
+	};
+
+	const FNodeClassMetadata& FBuchlaBongoOperator::GetNodeInfo()
+	{
+		auto CreateNodeClassMetadata = []()->FNodeClassMetadata
+		{
+			FNodeClassMetadata Info;
+			Info.ClassName = { FName("BuchlaBongo"), TEXT("Buchla Bongo"), FName("Audio") };
+			Info.MajorVersion = 1;
+			Info.MinorVersion = 0;
+			Info.DisplayName = METASOUND_LOCTEXT("BongoDisplayName", "Buchla Bongo");
+			Info.Description = METASOUND_LOCTEXT("BongoDescription", "Complete bongo voice, a pitched body and click through a low pass gate");
+			Info.Author = TEXT("Declan Shields");
+			Info.DefaultInterface = GetVertexInterface();
+			Info.CategoryHierarchy.Emplace(NodeCategories::Generators);
+
+			return Info;
+		};
+
+		static const FNodeClassMetadata Info = CreateNodeClassMetadata();
+
+		return Info;
+	}
+
+	const FVertexInterface& FBuchlaBongoOperator::GetVertexInterface()
+	{
+		using namespace BuchlaBongoNode;
+
+		static const FVertexInterface Interface(
+			FInputVertexInterface(
+				TInputDataVertex<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputTrigger)),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputFrequency), 200.0f),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputPitchDrop), 4.0f),
+				TInputDataVertex<FTime>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputPitchDecay), 0.03f),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputClickLevel), 0.5f),
+				TInputDataVertex<FTime>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputAttackTime), 0.001f),
+				TInputDataVertex<FTime>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputDecayTime), 0.3f),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputAttackCurve), 1.0f),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputDecayCurve), 0.5f),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputCutOff), 1500.0f),
+				TInputDataVertex<bool>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputVactrol), false)
+			),
+			FOutputVertexInterface(
+				TOutputDataVertex<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputOnDone)),
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputAudio))
+			)
+		);
+
+		return Interface;
+	}
+
+	TUniquePtr<IOperator> FBuchlaBongoOperator::CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors)
+	{
+		using namespace BuchlaBongoNode;
+
+		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+		const FDataReferenceCollection& Inputs = InParams.InputDataReferences;
+
+		FTriggerReadRef TriggerIn = Inputs.GetDataReadReferenceOrConstruct<FTrigger>(METASOUND_GET_PARAM_NAME(InputTrigger), InParams.OperatorSettings);
+		FFloatReadRef Frequency = Inputs.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InputFrequency), InParams.OperatorSettings);
+		FFloatReadRef PitchDrop = Inputs.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InputPitchDrop), InParams.OperatorSettings);
+		FTimeReadRef PitchDecay = Inputs.GetDataReadReferenceOrConstructWithVertexDefault<FTime>(InputInterface, METASOUND_GET_PARAM_NAME(InputPitchDecay), InParams.OperatorSettings);
+		FFloatReadRef ClickLevel = Inputs.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InputClickLevel), InParams.OperatorSettings);
+		FTimeReadRef AttackTime = Inputs.GetDataReadReferenceOrConstructWithVertexDefault<FTime>(InputInterface, METASOUND_GET_PARAM_NAME(InputAttackTime), InParams.OperatorSettings);
+		FTimeReadRef DecayTime = Inputs.GetDataReadReferenceOrConstructWithVertexDefault<FTime>(InputInterface, METASOUND_GET_PARAM_NAME(InputDecayTime), InParams.OperatorSettings);
+		FFloatReadRef AttackCurveFactor = Inputs.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InputAttackCurve), InParams.OperatorSettings);
+		FFloatReadRef DecayCurveFactor = Inputs.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InputDecayCurve), InParams.OperatorSettings);
+		FFloatReadRef CutOff = Inputs.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InputCutOff), InParams.OperatorSettings);
+		FBoolReadRef UseVactrol = Inputs.GetDataReadReferenceOrConstructWithVertexDefault<bool>(InputInterface, METASOUND_GET_PARAM_NAME(InputVactrol), InParams.OperatorSettings);
+
+		return MakeUnique<FBuchlaBongoOperator>(InParams.OperatorSettings, TriggerIn, Frequency, PitchDrop, PitchDecay, ClickLevel, AttackTime, DecayTime, AttackCurveFactor, DecayCurveFactor, CutOff, UseVactrol);
+	}
+
+	FBuchlaBongoOperator::FBuchlaBongoOperator(const FOperatorSettings& InSettings,
+		const FTriggerReadRef& InTriggerIn,
+		const FFloatReadRef& InFrequency,
+		const FFloatReadRef& InPitchDrop,
+		const FTimeReadRef& InPitchDecay,
+		const FFloatReadRef& InClickLevel,
+		const FTimeReadRef& InAttackTime,
+		const FTimeReadRef& InDecayTime,
+		const FFloatReadRef& InAttackCurveFactor,
+		const FFloatReadRef& InDecayCurveFactor,
+		const FFloatReadRef& InCutOff,
+		const FBoolReadRef& InUseVactrol) : TriggerIn(InTriggerIn)
+		, Frequency(InFrequency)
+		, PitchDrop(InPitchDrop)
+		, PitchDecay(InPitchDecay)
+		, ClickLevel(InClickLevel)
+		, AttackTime(InAttackTime)
+		, DecayTime(InDecayTime)
+		, AttackCurveFactor(InAttackCurveFactor)
+		, DecayCurveFactor(InDecayCurveFactor)
+		, CutOffFrequency(InCutOff)
+		, UseVactrol(InUseVactrol)
+		, OnDone(TDataWriteReferenceFactory<FTrigger>::CreateAny(InSettings))
+		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+		, EnvelopeBuffer(InSettings)
+		, CutOffTable(LowPassGateDSP::FCutOffTable::Get(InSettings.GetSampleRate()))
+		, VactrolTable(LowPassGateDSP::FVactrolTable::Get(InSettings.GetSampleRate()))
+	{
+		//The envelope can only finish once per trigger range
+		FinishedFrames.Reserve(4);
+
+		ResetState(InSettings);
+	}
+
+	void FBuchlaBongoOperator::Reset(const FOperatorSettings& InSettings)
+	{
+		//Pooled operators can be handed to a graph running at a different rate, fetch the matching tables
+		if (!FMath::IsNearlyEqual(SampleRate, InSettings.GetSampleRate()))
+		{
+			CutOffTable = LowPassGateDSP::FCutOffTable::Get(InSettings.GetSampleRate());
+			VactrolTable = LowPassGateDSP::FVactrolTable::Get(InSettings.GetSampleRate());
+		}
+
+		//Assigned through the references rather than recreated, whatever reads the outputs keeps reading the same objects
+		if (NumFramesPerBlock != InSettings.GetNumFramesPerBlock())
+		{
+			*AudioOutput = FAudioBuffer(InSettings);
+			EnvelopeBuffer = FAudioBuffer(InSettings);
+			*OnDone = FTrigger(InSettings);
+		}
+
+		ResetState(InSettings);
+	}
+
+	void FBuchlaBongoOperator::ResetState(const FOperatorSettings& InSettings)
+	{
+		SampleRate = InSettings.GetSampleRate();
+		NumFramesPerBlock = InSettings.GetNumFramesPerBlock();
+		ClickSampleCount = FMath::Max(1, FMath::RoundToInt(BuchlaBongoNode::ClickTime * SampleRate));
+
+		EnvelopeState.Reset();
+		EnvelopeBuffer.Zero();
+		FilterCoefficients = LowPassGateDSP::FSVFCoefficients();
+		FilterState.Reset();
+		GateGain = 0.0f;
+		VactrolLevel = 0.0f;
+
+		Phase = 0.0f;
+		PitchEnvelope = 0.0f;
+		PitchRange = 0.0f;
+		PitchDecayCoefficient = 0.0f;
+		ClickSamplesRemaining = 0;
+		NoiseSeed = 0;
+
+		//Forces every parameter to be recomputed on the first block and the first strike
+		PreviousFrequency = -1.0f;
+		PreviousAttackTime = -1.0f;
+		PreviousDecayTime = -1.0f;
+		PreviousAttackCurve = -1.0f;
+		PreviousDecayCurve = -1.0f;
+		PreviousPitchDrop = -1.0f;
+		PreviousPitchDecay = -1.0f;
+
+		bIsCulled = false;
+		BudgetVoice.ResetPeak();
+		BudgetVoice.LeaveRanking();
+
+		OnDone->Reset();
+		AudioOutput->Zero();
+		bIsOutputCleared = true;
+	}
+
+	FDataReferenceCollection FBuchlaBongoOperator::GetInputs() const
+	{
+		using namespace BuchlaBongoNode;
+
+		FDataReferenceCollection Inputs;
+		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputTrigger), TriggerIn);
+		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputFrequency), Frequency);
+		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputPitchDrop), PitchDrop);
+		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputPitchDecay), PitchDecay);
+		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputClickLevel), ClickLevel);
+		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputAttackTime), AttackTime);
+		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputDecayTime), DecayTime);
+		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputAttackCurve), AttackCurveFactor);
+		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputDecayCurve), DecayCurveFactor);
+		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputCutOff), CutOffFrequency);
+		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputVactrol), UseVactrol);
+
+		return Inputs;
+	}
+
+	FDataReferenceCollection FBuchlaBongoOperator::GetOutputs() const
+	{
+		using namespace BuchlaBongoNode;
+
+		FDataReferenceCollection Outputs;
+		Outputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputOnDone), OnDone);
+		Outputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputAudio), AudioOutput);
+
+		return Outputs;
+	}
+
+	void FBuchlaBongoOperator::StartHit()
+	{
+		Envelope::Retrigger(EnvelopeState);
+
+		//The pitch falls back to Frequency as a ratio, so the per-sample loop needs no exp2()
+		const float PitchDropSemitones = FMath::Max(0.0f, *PitchDrop);
+		if (PitchDropSemitones != PreviousPitchDrop)
+		{
+			HitPitchRange = FMath::Pow(2.0f, PitchDropSemitones / 12.0f) - 1.0f;
+			PreviousPitchDrop = PitchDropSemitones;
+		}
+		const float PitchDecaySeconds = (float)PitchDecay->GetSeconds();
+		if (PitchDecaySeconds != PreviousPitchDecay)
+		{
+			HitPitchDecayCoefficient = FMath::Exp(-1.0f / FMath::Max(KINDA_SMALL_NUMBER, PitchDecaySeconds * SampleRate));
+			PreviousPitchDecay = PitchDecaySeconds;
+		}
+
+		//Latched for the strike, changing the pins mid-strike only affects the next one
+		Phase = 0.0f;
+		PitchEnvelope = 1.0f;
+		PitchRange = HitPitchRange;
+		PitchDecayCoefficient = HitPitchDecayCoefficient;
+
+		ClickSamplesRemaining = ClickSampleCount;
+		NoiseSeed = 22222u;
+	}
+
+	void FBuchlaBongoOperator::UpdateEnvelope()
+	{
+		const int32 MinControlRate = BudgetVoice.GetDegradation() >= ELowPassGateDegradation::ControlRateEnvelope ? FLowPassGateBudget::DegradedControlRate : 1;
+		EnvelopeState.ControlRate = FMath::Max(BuchlaBongoCVars::GetEnvelopeControlRate(), MinControlRate);
+
+		const float AttackTimeSeconds = (float)AttackTime->GetSeconds();
+		const float DecayTimeSeconds = (float)DecayTime->GetSeconds();
+		if (!FMath::IsNearlyEqual(PreviousAttackTime, AttackTimeSeconds) || !FMath::IsNearlyEqual(PreviousDecayTime, DecayTimeSeconds))
+		{
+			EnvelopeState.AttackSampleCount = FMath::Max(1, SampleRate * AttackTimeSeconds);
+			EnvelopeState.DecaySampleCount = FMath::Max(1, SampleRate * DecayTimeSeconds);
+			PreviousAttackTime = AttackTimeSeconds;
+			PreviousDecayTime = DecayTimeSeconds;
+		}
+
+		const float CurrentAttackCurve = FMath::Max(KINDA_SMALL_NUMBER, *AttackCurveFactor);
+		const float CurrentDecayCurve = FMath::Max(KINDA_SMALL_NUMBER, *DecayCurveFactor);
+		if (!FMath::IsNearlyEqual(PreviousAttackCurve, CurrentAttackCurve) || !FMath::IsNearlyEqual(PreviousDecayCurve, CurrentDecayCurve))
+		{
+			EnvelopeState.SetCurveFactors(CurrentAttackCurve, CurrentDecayCurve, NumFramesPerBlock);
+			PreviousAttackCurve = CurrentAttackCurve;
+			PreviousDecayCurve = CurrentDecayCurve;
+		}
+	}
+
+	void FBuchlaBongoOperator::UpdateFilter()
+	{
+		const float CurrentFrequency = FMath::Clamp(*CutOffFrequency, 0.f, (0.5f * SampleRate));
+
+		if (!FMath::IsNearlyEqual(PreviousFrequency, CurrentFrequency))
+		{
+			FilterCoefficients.Set(CurrentFrequency, 0.0f, SampleRate);
+			PreviousFrequency = CurrentFrequency;
+		}
+
+		//Same cut off to gain mapping as the low pass gate's Both mode
+		GateGain = FMath::GetMappedRangeValueClamped(TRange<float>(0.0f, 1500.0f), TRange<float>(0.0f, 1.0f), *CutOffFrequency);
+	}
+
+	template<bool bUseVactrol>
+	void FBuchlaBongoOperator::RenderVoice(int32 StartFrame, int32 EndFrame)
+	{
+		using namespace LowPassGateDSP;
+
+		const float* EnvelopeValues = EnvelopeBuffer.GetData();
+		float* OutputAudio = AudioOutput->GetData();
+
+		const float PhaseIncrement = FMath::Clamp(*Frequency, 0.0f, 0.25f * SampleRate) / SampleRate;
+		const float Click = *ClickLevel;
+		const float ClickScale = 1.0f / ClickSampleCount;
+
+		[[maybe_unused]] const float DarkOctaves = FCutOffTable::FrequencyToOctaves(PreviousFrequency) - FVactrolTable::CutOffRangeOctaves;
+		const FCutOffTable& CutOffs = *CutOffTable;
+		const FVactrolTable& Vactrol = *VactrolTable;
+
+		FSVFCoefficients Coefficients = FilterCoefficients;
+		FSVFState State = FilterState;
+
+		for (int32 i = StartFrame; i < EndFrame; ++i)
+		{
+			//Drum body, a sine that starts sharp and falls back to Frequency
+			//Pitch Drop is unbounded, so the increment can pass a whole cycle and the wrap has to take every one off
+			Phase += PhaseIncrement * (1.0f + PitchRange * PitchEnvelope);
+			Phase -= FMath::FloorToFloat(Phase);
+			PitchEnvelope *= PitchDecayCoefficient;
+
+			float Excitation = FastSineCycles(Phase);
+
+			//Stick click, a short burst of noise fading out linearly
+			if (ClickSamplesRemaining > 0)
+			{
+				Excitation += Click * NextNoise() * (ClickSamplesRemaining * ClickScale);
+				--ClickSamplesRemaining;
+			}
+
+			if constexpr (bUseVactrol)
+			{
+				OutputAudio[i] = ProcessVactrolSample(Vactrol, CutOffs, DarkOctaves, EnvelopeValues[i], VactrolLevel, Coefficients, State, Excitation);
+			}
+			else
+			{
+				OutputAudio[i] = ProcessLowPassSample(Coefficients, State, Excitation) * EnvelopeValues[i] * GateGain;
+			}
+		}
+
+		FilterState = State;
+	}
+
+	void FBuchlaBongoOperator::RenderRange(int32 StartFrame, int32 EndFrame)
+	{
+		FinishedFrames.Reset();
+		Envelope::GetNextEnvelopeOutput(EnvelopeState, StartFrame, EndFrame, FinishedFrames, EnvelopeBuffer.GetData());
+		for (int32 FrameFinished : FinishedFrames)
+		{
+			OnDone->TriggerFrame(FrameFinished);
+		}
+
+		if (*UseVactrol)
+		{
+			RenderVoice<true>(StartFrame, EndFrame);
+		}
+		else
+		{
+			RenderVoice<false>(StartFrame, EndFrame);
+		}
+	}
+
+	void FBuchlaBongoOperator::FastRelease()
+	{
+		//Same release as a culled low pass gate, one block is short enough to shed the voice and long enough not to click
+		Audio::ArrayFade(MakeArrayView(AudioOutput->GetData(), AudioOutput->Num()), 1.0f, 0.0f);
+
+		if (EnvelopeState.CurrentSampleIndex != INDEX_NONE)
+		{
+			OnDone->TriggerFrame(AudioOutput->Num() - 1);
+		}
+		EnvelopeState.CurrentSampleIndex = INDEX_NONE;
+		EnvelopeState.CurrentEnvelopeValue = 0.0f;
+		VactrolLevel = 0.0f;
+		bIsCulled = true;
+
+		INC_DWORD_STAT(STAT_BuchlaBongo_CulledGates);
+	}
+
+	void FBuchlaBongoOperator::Execute()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(BuchlaBongo::BongoExecute);
+		SCOPE_CYCLE_COUNTER(STAT_BuchlaBongo_BongoExecute);
+
+#if BUCHLABONGO_RENDER_ALLOCATION_CHECKS
+		//Only counts while allocation tracking is installed, see BuchlaBongoAllocations.h
+		BuchlaBongoAllocations::FRenderScope AllocationScope(TEXT("Buchla Bongo"));
+#endif
+
+		const uint64 StartCycles = BudgetVoice.BeginBlock();
+		ON_SCOPE_EXIT
+		{
+			BudgetVoice.EndBlock(StartCycles, SampleRate, NumFramesPerBlock);
+		};
+
+		OnDone->AdvanceBlock();
+
+		//Between strikes there is nothing to render, the output is zeroed once and then left alone
+		const bool bIsCellDark = !*UseVactrol || LowPassGateDSP::FVactrolTable::GetGain(VactrolLevel) < LowPassGateDSP::SilenceThreshold;
+		if (EnvelopeState.CurrentSampleIndex == INDEX_NONE && bIsCellDark && !TriggerIn->IsTriggeredInBlock())
+		{
+			if (!bIsOutputCleared)
+			{
+				AudioOutput->Zero();
+				FilterState.Reset();
+				VactrolLevel = 0.0f;
+				bIsOutputCleared = true;
+				//A culled bongo keeps its place in the ranking until it is struck again
+				if (!bIsCulled)
+				{
+					BudgetVoice.LeaveRanking();
+				}
+			}
+			return;
+		}
+		bIsOutputCleared = false;
+
+		if (TriggerIn->IsTriggeredInBlock())
+		{
+			bIsCulled = false;
+			BudgetVoice.ResetPeak();
+		}
+
+		UpdateEnvelope();
+		UpdateFilter();
+
+		//One pass over the block, rendered up to each strike and restarted in place like the low pass gate's envelope
+		const int32 NumTriggers = TriggerIn->NumTriggeredInBlock();
+		int32 Frame = 0;
+		for (int32 TriggerIndex = 0; TriggerIndex <= NumTriggers; ++TriggerIndex)
+		{
+			const int32 EndFrame = TriggerIndex < NumTriggers ? FMath::Clamp((*TriggerIn)[TriggerIndex], Frame, NumFramesPerBlock) : NumFramesPerBlock;
+			if (EndFrame > Frame)
+			{
+				RenderRange(Frame, EndFrame);
+				Frame = EndFrame;
+			}
+			else if (TriggerIndex > 0 && EndFrame == (*TriggerIn)[TriggerIndex - 1])
+			{
+				//A second strike on the same frame would only restart the one that just started
+				continue;
+			}
+
+			if (TriggerIndex < NumTriggers && EndFrame < NumFramesPerBlock)
+			{
+				StartHit();
+			}
+		}
+
+		FilterState.FlushDenormals();
+		VactrolLevel = LowPassGateDSP::FlushDenormal(VactrolLevel);
+
+		if (BudgetVoice.IsMeasuring() && BudgetVoice.ShouldCull(LowPassGateDSP::GetPeak(AudioOutput->GetData(), AudioOutput->Num())))
+		{
+			FastRelease();
+		}
+	}
+
+	class FBuchlaBongoNode : public FNodeFacade
+	{
+	public:
+		FBuchlaBongoNode(const FNodeInitData& InInitData)
+			: FNodeFacade(InInitData.InstanceName, InInitData.InstanceID, TFacadeOperatorClass<FBuchlaBongoOperator>())
+		{}
+	};
+
+	METASOUND_REGISTER_NODE(FBuchlaBongoNode);
+}
+
+#undef LOCTEXT_NAMESPACE
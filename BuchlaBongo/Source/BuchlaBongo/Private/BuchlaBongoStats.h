@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+//Everything this plugin renders on the audio thread shows up under "stat BuchlaBongo" and the BuchlaBongo CSV category
+DECLARE_STATS_GROUP(TEXT("BuchlaBongo"), STATGROUP_BuchlaBongo, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("LPG Execute"), STAT_BuchlaBongo_LPGExecute, STATGROUP_BuchlaBongo, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("LPG Envelope"), STAT_BuchlaBongo_LPGEnvelope, STATGROUP_BuchlaBongo, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("LPG Filter Update"), STAT_BuchlaBongo_LPGFilterUpdate, STATGROUP_BuchlaBongo, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("LPG Multichannel Execute"), STAT_BuchlaBongo_LPGMultichannelExecute, STATGROUP_BuchlaBongo, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("LPG Voice Bank Execute"), STAT_BuchlaBongo_VoiceBankExecute, STATGROUP_BuchlaBongo, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Bongo Execute"), STAT_BuchlaBongo_BongoExecute, STATGROUP_BuchlaBongo, );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("LPG Coefficient Updates"), STAT_BuchlaBongo_CoefficientUpdates, STATGROUP_BuchlaBongo, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("LPG Triggers"), STAT_BuchlaBongo_Triggers, STATGROUP_BuchlaBongo, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("LPG Culled"), STAT_BuchlaBongo_CulledGates, STATGROUP_BuchlaBongo, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("LPG Active"), STAT_BuchlaBongo_ActiveGates, STATGROUP_BuchlaBongo, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("LPG Sleeping"), STAT_BuchlaBongo_SleepingGates, STATGROUP_BuchlaBongo, );
+
+CSV_DECLARE_CATEGORY_EXTERN(BuchlaBongo);
@@ -0,0 +1,398 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DSP/Dsp.h"
+#include "BuchlaLowPassGateDSP.h"
+
+namespace Metasound
+{
+	//Envelope structs are from MetasoundADEnvelopeNode.cpp
+	//The original version is templated to work with either audio or float output
+	//Audio envelopes were not needed for this project, so only the float structs were used
+	//The ease and the looping and hard reset flags of the original are dropped, nothing here loops or eases
+	struct FEnvelopeState
+	{
+		int32 CurrentSampleIndex = INDEX_NONE;
+		int32 AttackSampleCount = 1;
+		int32 DecaySampleCount = 1;
+		float AttackCurveFactor = 0.0f;
+		float DecayCurveFactor = 0.0f;
+		float StartingEnvelopeValue = 0.0f;
+		float CurrentEnvelopeValue = 0.0f;
+
+		//Curve changes glide to their target over CurveRampFrames rather than stepping mid-segment
+		float AttackCurveTarget = 0.0f;
+		float DecayCurveTarget = 0.0f;
+		float AttackCurveDelta = 0.0f;
+		float DecayCurveDelta = 0.0f;
+		int32 CurveRampFrames = 0;
+
+		//Samples between exact evaluations of the curve, the envelope is interpolated linearly in between
+		//Control points are counted from the start of each segment, so they do not move with the block size
+		int32 ControlRate = 1;
+
+		void SetCurveFactors(float InAttackCurveFactor, float InDecayCurveFactor, int32 InRampFrames)
+		{
+			AttackCurveTarget = InAttackCurveFactor;
+			DecayCurveTarget = InDecayCurveFactor;
+
+			//An idle envelope has nothing to click, so it takes the new curves straight away
+			if (CurrentSampleIndex == INDEX_NONE || InRampFrames <= 0)
+			{
+				AttackCurveFactor = InAttackCurveFactor;
+				DecayCurveFactor = InDecayCurveFactor;
+				CurveRampFrames = 0;
+				return;
+			}
+
+			AttackCurveDelta = (InAttackCurveFactor - AttackCurveFactor) / InRampFrames;
+			DecayCurveDelta = (InDecayCurveFactor - DecayCurveFactor) / InRampFrames;
+			CurveRampFrames = InRampFrames;
+		}
+
+		void FinishCurveRamp()
+		{
+			AttackCurveFactor = AttackCurveTarget;
+			DecayCurveFactor = DecayCurveTarget;
+			CurveRampFrames = 0;
+		}
+
+		void Reset()
+		{
+			CurrentSampleIndex = INDEX_NONE;
+			AttackSampleCount = 1;
+			DecaySampleCount = 1;
+
+			AttackCurveFactor = 0.0f;
+			DecayCurveFactor = 0.0f;
+
+			StartingEnvelopeValue = 0.0f;
+			CurrentEnvelopeValue = 0.0f;
+
+			AttackCurveTarget = 0.0f;
+			DecayCurveTarget = 0.0f;
+			CurveRampFrames = 0;
+			ControlRate = 1;
+		}
+	};
+
+	struct Envelope
+	{
+		//Attack rises from its start value to 1 and decay falls from 1 to 0, both are Offset + Scale * Fraction^Curve
+		struct FSegmentShape
+		{
+			float Offset = 0.0f;
+			float Scale = 1.0f;
+
+			FORCEINLINE float operator()(float InShape) const
+			{
+				return Offset + Scale * InShape;
+			}
+
+			FORCEINLINE VectorRegister4Float operator()(const VectorRegister4Float& InShape) const
+			{
+				return VectorMultiplyAdd(VectorSetFloat1(Scale), InShape, VectorSetFloat1(Offset));
+			}
+		};
+
+		//Restarts the attack from wherever the envelope is, so a retrigger mid-decay does not click
+		//Only the position changes, the segment lengths and curves set for the block are kept
+		static FORCEINLINE void Retrigger(FEnvelopeState& InState)
+		{
+			InState.CurrentSampleIndex = 0;
+			InState.StartingEnvelopeValue = InState.CurrentEnvelopeValue;
+		}
+
+		//Unlike the block-rate version in MetasoundADEnvelopeNode.cpp this writes one value per sample
+		//for the frames [StartFrame, EndFrame) so triggers land on their exact frame within the block
+		static void GetNextEnvelopeOutput(FEnvelopeState& InState, int32 StartFrame, int32 EndFrame, TArray<int32>& OutFinishedFrames, float* OutEnvelope)
+		{
+			// Envelope is idle, nothing to generate for this range
+			if (InState.CurrentSampleIndex == INDEX_NONE)
+			{
+				ZeroRange(OutEnvelope, StartFrame, EndFrame);
+				InState.CurrentEnvelopeValue = 0.0f;
+				return;
+			}
+
+			const int32 TotalEnvSampleCount = InState.AttackSampleCount + InState.DecaySampleCount;
+			int32 Frame = StartFrame;
+
+			// We are in attack
+			if (Frame < EndFrame && InState.CurrentSampleIndex < InState.AttackSampleCount)
+			{
+				const int32 NumFrames = FMath::Min(EndFrame - Frame, InState.AttackSampleCount - InState.CurrentSampleIndex);
+
+				if (InState.AttackSampleCount > 1)
+				{
+					const float Start = InState.StartingEnvelopeValue;
+					RenderSegment(InState, Frame, NumFrames, InState.AttackSampleCount, (float)InState.CurrentSampleIndex, InState.AttackCurveFactor, InState.AttackCurveDelta, OutEnvelope,
+						FSegmentShape{ Start, 1.0f - Start });
+				}
+				else
+				{
+					// Attack is effectively 0, skip Attack fade-in
+					for (int32 Offset = 0; Offset < NumFrames; ++Offset)
+					{
+						OutEnvelope[Frame + Offset] = 1.0f;
+					}
+				}
+
+				AdvanceSegment(InState, Frame, NumFrames, OutEnvelope);
+			}
+
+			// We are in Decay
+			if (Frame < EndFrame && InState.CurrentSampleIndex < TotalEnvSampleCount)
+			{
+				const int32 NumFrames = FMath::Min(EndFrame - Frame, TotalEnvSampleCount - InState.CurrentSampleIndex);
+
+				RenderSegment(InState, Frame, NumFrames, InState.DecaySampleCount, (float)(InState.CurrentSampleIndex - InState.AttackSampleCount), InState.DecayCurveFactor, InState.DecayCurveDelta, OutEnvelope,
+					FSegmentShape{ 1.0f, -1.0f });
+
+				AdvanceSegment(InState, Frame, NumFrames, OutEnvelope);
+			}
+
+			if (Frame < EndFrame)
+			{
+				// Envelope is done on this frame, the remainder of the range is silent
+				InState.CurrentSampleIndex = INDEX_NONE;
+				InState.CurrentEnvelopeValue = 0.0f;
+				InState.FinishCurveRamp();
+				OutFinishedFrames.Add(Frame);
+				ZeroRange(OutEnvelope, Frame, EndFrame);
+			}
+		}
+
+		//Four envelopes side by side, one vector per frame, for the frames [StartFrame, EndFrame) as GetNextEnvelopeOutput does for one
+		//Each frame's four values are stored together at OutEnvelope[Frame * InStride], which must be 16 byte aligned
+		//Every lane keeps its own position, segment lengths, curves and control rate, curve ramps are not followed
+		static void GetNextEnvelopeOutputLanes(FEnvelopeState* InStates, int32 StartFrame, int32 EndFrame, TArray<int32>& OutFinishedFrames, float* OutEnvelope, int32 InStride)
+		{
+			if (EndFrame <= StartFrame)
+			{
+				return;
+			}
+
+			const VectorRegister4Float Zero = VectorZeroFloat();
+			const VectorRegister4Float One = VectorOneFloat();
+
+			if (InStates[0].CurrentSampleIndex == INDEX_NONE && InStates[1].CurrentSampleIndex == INDEX_NONE && InStates[2].CurrentSampleIndex == INDEX_NONE && InStates[3].CurrentSampleIndex == INDEX_NONE)
+			{
+				for (int32 Frame = StartFrame; Frame < EndFrame; ++Frame)
+				{
+					VectorStoreAligned(Zero, &OutEnvelope[Frame * InStride]);
+				}
+				return;
+			}
+
+			alignas(16) float Lanes[9][4];
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				const FEnvelopeState& State = InStates[Lane];
+				//Idle lanes sit at -1, finished ones run past the end of the decay, neither is written
+				Lanes[0][Lane] = (float)State.CurrentSampleIndex;
+				Lanes[1][Lane] = (float)State.AttackSampleCount;
+				Lanes[2][Lane] = (float)State.DecaySampleCount;
+				Lanes[3][Lane] = 1.0f / State.AttackSampleCount;
+				Lanes[4][Lane] = 1.0f / State.DecaySampleCount;
+				Lanes[5][Lane] = State.AttackCurveFactor;
+				Lanes[6][Lane] = State.DecayCurveFactor;
+				//A one sample attack is written as 1 rather than its start value, as GetNextEnvelopeOutput skips it
+				Lanes[7][Lane] = State.AttackSampleCount > 1 ? State.StartingEnvelopeValue : 1.0f;
+				Lanes[8][Lane] = (float)FMath::Max(1, State.ControlRate);
+			}
+
+			VectorRegister4Float Index = VectorLoadAligned(Lanes[0]);
+			const VectorRegister4Float AttackLength = VectorLoadAligned(Lanes[1]);
+			const VectorRegister4Float DecayLength = VectorLoadAligned(Lanes[2]);
+			const VectorRegister4Float TotalLength = VectorAdd(AttackLength, DecayLength);
+			const VectorRegister4Float AttackStep = VectorLoadAligned(Lanes[3]);
+			const VectorRegister4Float DecayStep = VectorLoadAligned(Lanes[4]);
+			const VectorRegister4Float AttackCurve = VectorLoadAligned(Lanes[5]);
+			const VectorRegister4Float DecayCurve = VectorLoadAligned(Lanes[6]);
+			const VectorRegister4Float AttackOffset = VectorLoadAligned(Lanes[7]);
+			const VectorRegister4Float AttackScale = VectorSubtract(One, AttackOffset);
+			const VectorRegister4Float ControlRate = VectorLoadAligned(Lanes[8]);
+
+			//Each lane is a straight run between two control points, at a control rate of 1 every sample is a control point
+			VectorRegister4Float RunStart = Zero;
+			VectorRegister4Float RunEnd = Zero;
+			VectorRegister4Float RunStep = Zero;
+			VectorRegister4Float RunPhase = Zero;
+			VectorRegister4Float RunFramesLeft = Zero;
+
+			//Starts the next run on the lanes in InMask, runs inside a range start where the last one ended so only the end point is evaluated
+			auto StartRuns = [&](const VectorRegister4Float& InMask, bool bInEvaluateStart)
+			{
+				const VectorRegister4Float IsAttack = VectorCompareLT(Index, AttackLength);
+				const VectorRegister4Float SegmentIndex = VectorSelect(IsAttack, Index, VectorSubtract(Index, AttackLength));
+				const VectorRegister4Float SegmentLength = VectorSelect(IsAttack, AttackLength, DecayLength);
+				const VectorRegister4Float FractionStep = VectorSelect(IsAttack, AttackStep, DecayStep);
+				const VectorRegister4Float Curve = VectorSelect(IsAttack, AttackCurve, DecayCurve);
+				const VectorRegister4Float Offset = VectorSelect(IsAttack, AttackOffset, One);
+				const VectorRegister4Float Scale = VectorSelect(IsAttack, AttackScale, VectorNegate(One));
+
+				const VectorRegister4Float Phase = VectorMod(SegmentIndex, ControlRate);
+				const VectorRegister4Float ControlIndex = VectorSubtract(SegmentIndex, Phase);
+				const VectorRegister4Float NextControlIndex = VectorMin(VectorAdd(ControlIndex, ControlRate), SegmentLength);
+				const VectorRegister4Float EndValue = VectorMultiplyAdd(Scale, LowPassGateDSP::VectorFastPowFraction(VectorMultiply(NextControlIndex, FractionStep), Curve), Offset);
+				const VectorRegister4Float StartValue = bInEvaluateStart ? VectorMultiplyAdd(Scale, LowPassGateDSP::VectorFastPowFraction(VectorMultiply(ControlIndex, FractionStep), Curve), Offset) : RunEnd;
+
+				RunStart = VectorSelect(InMask, StartValue, RunStart);
+				RunEnd = VectorSelect(InMask, EndValue, RunEnd);
+				RunStep = VectorSelect(InMask, VectorDivide(VectorSubtract(EndValue, StartValue), VectorSubtract(NextControlIndex, ControlIndex)), RunStep);
+				RunPhase = VectorSelect(InMask, Phase, RunPhase);
+				RunFramesLeft = VectorSelect(InMask, VectorSubtract(NextControlIndex, SegmentIndex), RunFramesLeft);
+			};
+
+			auto GetActiveLanes = [&]()
+			{
+				return VectorBitwiseAnd(VectorCompareGE(Index, Zero), VectorCompareLT(Index, TotalLength));
+			};
+
+			StartRuns(GetActiveLanes(), true);
+
+			for (int32 Frame = StartFrame; Frame < EndFrame; ++Frame)
+			{
+				const VectorRegister4Float IsActive = GetActiveLanes();
+				const VectorRegister4Float IsRunDone = VectorBitwiseAnd(IsActive, VectorCompareLE(RunFramesLeft, Zero));
+				if (VectorMaskBits(IsRunDone))
+				{
+					StartRuns(IsRunDone, false);
+				}
+
+				VectorStoreAligned(VectorSelect(IsActive, VectorMultiplyAdd(RunStep, RunPhase, RunStart), Zero), &OutEnvelope[Frame * InStride]);
+
+				Index = VectorAdd(Index, VectorBitwiseAnd(IsActive, One));
+				RunPhase = VectorAdd(RunPhase, One);
+				RunFramesLeft = VectorSubtract(RunFramesLeft, One);
+			}
+
+			//Positions, finishes and the last value of each lane are worked out from the range, the same as GetNextEnvelopeOutput leaves them
+			const int32 NumFrames = EndFrame - StartFrame;
+			for (int32 Lane = 0; Lane < 4; ++Lane)
+			{
+				FEnvelopeState& State = InStates[Lane];
+				if (State.CurrentSampleIndex == INDEX_NONE)
+				{
+					State.CurrentEnvelopeValue = 0.0f;
+					continue;
+				}
+
+				const int32 FramesLeft = FMath::Max(0, State.AttackSampleCount + State.DecaySampleCount - State.CurrentSampleIndex);
+				if (FramesLeft < NumFrames)
+				{
+					State.CurrentSampleIndex = INDEX_NONE;
+					State.CurrentEnvelopeValue = 0.0f;
+					State.FinishCurveRamp();
+					OutFinishedFrames.Add(StartFrame + FramesLeft);
+				}
+				else
+				{
+					State.CurrentSampleIndex += NumFrames;
+					State.CurrentEnvelopeValue = OutEnvelope[(EndFrame - 1) * InStride + Lane];
+				}
+			}
+		}
+
+		//Writes Fraction^Curve through InShape for NumFrames
+		//A pending curve ramp is evaluated in closed form rather than stepped through the state
+		//Written four frames at a time with VectorRegister4Float, the frames left over are done one by one
+		static FORCEINLINE void RenderSegment(const FEnvelopeState& InState, int32 InFrame, int32 InNumFrames, int32 InSegmentLength, float InFirstIndex, float InCurve, float InCurveDelta, float* OutEnvelope, const FSegmentShape& InShape)
+		{
+			const int32 RampFrames = InState.CurveRampFrames;
+			const float CurveDelta = RampFrames > 0 ? InCurveDelta : 0.0f;
+			const float FractionStep = 1.0f / InSegmentLength;
+
+			if (InState.ControlRate > 1)
+			{
+				RenderSegmentAtControlRate(InState.ControlRate, RampFrames, InFrame, InNumFrames, InSegmentLength, (int32)InFirstIndex, InCurve, CurveDelta, OutEnvelope, InShape);
+				return;
+			}
+
+			const VectorRegister4Float LaneOffsets = MakeVectorRegisterFloat(0.0f, 1.0f, 2.0f, 3.0f);
+			const VectorRegister4Float FirstIndex = VectorSetFloat1(InFirstIndex);
+			const VectorRegister4Float FractionScale = VectorSetFloat1(FractionStep);
+			const VectorRegister4Float Curve = VectorSetFloat1(InCurve);
+			const VectorRegister4Float Delta = VectorSetFloat1(CurveDelta);
+			const VectorRegister4Float Ramp = VectorSetFloat1((float)RampFrames);
+
+			int32 Offset = 0;
+			for (; Offset + 4 <= InNumFrames; Offset += 4)
+			{
+				const VectorRegister4Float Frames = VectorAdd(VectorSetFloat1((float)Offset), LaneOffsets);
+				const VectorRegister4Float FrameCurve = VectorMultiplyAdd(Delta, VectorMin(VectorAdd(Frames, VectorOneFloat()), Ramp), Curve);
+				const VectorRegister4Float Fraction = VectorMultiply(VectorAdd(FirstIndex, Frames), FractionScale);
+
+				VectorStore(InShape(LowPassGateDSP::VectorFastPowFraction(Fraction, FrameCurve)), &OutEnvelope[InFrame + Offset]);
+			}
+
+			for (; Offset < InNumFrames; ++Offset)
+			{
+				const float Curve = InCurve + CurveDelta * (float)FMath::Min(Offset + 1, RampFrames);
+				const float Fraction = (InFirstIndex + (float)Offset) * FractionStep;
+
+				OutEnvelope[InFrame + Offset] = InShape(LowPassGateDSP::FastPowFraction(Fraction, Curve));
+			}
+		}
+
+		//Evaluates the curve once every InControlRate samples of the segment and interpolates between the control points
+		//The last control point is the end of the segment itself, so a segment that is not a multiple of the rate still lands on its end value
+		static FORCEINLINE void RenderSegmentAtControlRate(int32 InControlRate, int32 InRampFrames, int32 InFrame, int32 InNumFrames, int32 InSegmentLength, int32 InFirstIndex, float InCurve, float InCurveDelta, float* OutEnvelope, const FSegmentShape& InShape)
+		{
+			const float FractionStep = 1.0f / InSegmentLength;
+
+			int32 Offset = 0;
+			int32 Phase = InFirstIndex % InControlRate;
+			int32 ControlIndex = InFirstIndex - Phase;
+			float Curve = InCurve + InCurveDelta * (float)FMath::Min(1, InRampFrames);
+			float StartValue = InShape(LowPassGateDSP::FastPowFraction((float)ControlIndex * FractionStep, Curve));
+
+			while (Offset < InNumFrames)
+			{
+				const int32 NextControlIndex = FMath::Min(ControlIndex + InControlRate, InSegmentLength);
+				const int32 NumRunFrames = FMath::Min(NextControlIndex - ControlIndex - Phase, InNumFrames - Offset);
+				Curve = InCurve + InCurveDelta * (float)FMath::Min(Offset + 1, InRampFrames);
+				const float EndValue = InShape(LowPassGateDSP::FastPowFraction((float)NextControlIndex * FractionStep, Curve));
+				const float Step = (EndValue - StartValue) / (float)(NextControlIndex - ControlIndex);
+
+				for (int32 Run = 0; Run < NumRunFrames; ++Run)
+				{
+					OutEnvelope[InFrame + Offset + Run] = StartValue + Step * (float)(Phase + Run);
+				}
+
+				//Each run starts where the last one ended, so the envelope stays continuous even while the curve ramps
+				Offset += NumRunFrames;
+				ControlIndex = NextControlIndex;
+				StartValue = EndValue;
+				Phase = 0;
+			}
+		}
+
+		static FORCEINLINE void AdvanceSegment(FEnvelopeState& InState, int32& InOutFrame, int32 InNumFrames, const float* InEnvelope)
+		{
+			if (InState.CurveRampFrames > 0)
+			{
+				if (InNumFrames >= InState.CurveRampFrames)
+				{
+					InState.FinishCurveRamp();
+				}
+				else
+				{
+					InState.AttackCurveFactor += InState.AttackCurveDelta * InNumFrames;
+					InState.DecayCurveFactor += InState.DecayCurveDelta * InNumFrames;
+					InState.CurveRampFrames -= InNumFrames;
+				}
+			}
+
+			InState.CurrentSampleIndex += InNumFrames;
+			InOutFrame += InNumFrames;
+			InState.CurrentEnvelopeValue = InEnvelope[InOutFrame - 1];
+		}
+
+		static void ZeroRange(float* OutEnvelope, int32 StartFrame, int32 EndFrame)
+		{
+			FMemory::Memzero(&OutEnvelope[StartFrame], sizeof(float) * (EndFrame - StartFrame));
+		}
+	};
+}
@@ -1,3 +1,7 @@
+#include "BuchlaLowPassGate.h"
+#include "BuchlaLowPassGateHitCache.h"
+#include "BuchlaLowPassGateControl.h"
+#include "BuchlaLowPassGateBudget.h"
 #include "Internationalization/Text.h"
 #include "MetasoundExecutableOperator.h"
 #include "MetasoundNodeRegistrationMacro.h"
@@ -12,27 +16,29 @@
 #include "MetasoundStandardNodesCategories.h"
 #include "MetasoundFacade.h"
 #include "DSP/Dsp.h"
-#include "DSP/Filter.h"
 #include "DSP/InterpolatedOnePole.h"
+#include "DSP/FloatArrayMath.h"
+#include "Misc/ScopeExit.h"
+#include "HAL/PlatformTime.h"
+#include "BuchlaBongoStats.h"
+#include "BuchlaBongoCVars.h"
 
 #define LOCTEXT_NAMESPACE "BuchlaBongo_LPG"
 
 namespace Metasound
 {
-	//Enum class used to set the mode of the Low Pass Gate
-	//The declaration was informed by the MetasoundWaveShaperNode.cpp
-	enum class ELowPassGateMode : int32
-	{
-		LowPass,
-		VCA,
-		Both
-	};
-
-	DECLARE_METASOUND_ENUM(ELowPassGateMode, ELowPassGateMode::LowPass, BUCHLABONGO_API, FEnumELowPassGateMode, FEnumLowPassGateModeInfo, FEnumLowPassGateModeReadRef, FEnumLowPassGateModeWriteRef);
 	DEFINE_METASOUND_ENUM_BEGIN(ELowPassGateMode, FEnumELowPassGateMode, "LowPassGateMode")
 		DEFINE_METASOUND_ENUM_ENTRY(ELowPassGateMode::LowPass, "LowPassDescription", "Low Pass", "LowPassTT", "Low Pass Mode"),
 		DEFINE_METASOUND_ENUM_ENTRY(ELowPassGateMode::VCA, "VCADescription", "VCA", "VCATT", "VCA Mode"),
-		DEFINE_METASOUND_ENUM_ENTRY(ELowPassGateMode::Both, "BothDescription", "Both", "BothTT", "Both Mode")
+		DEFINE_METASOUND_ENUM_ENTRY(ELowPassGateMode::Both, "BothDescription", "Both", "BothTT", "Both Mode"),
+		DEFINE_METASOUND_ENUM_ENTRY(ELowPassGateMode::Vactrol, "VactrolDescription", "Vactrol", "VactrolTT", "Models the vactrol of a Buchla low pass gate, the envelope drives cut off and amplitude together"),
+		DEFINE_METASOUND_ENUM_ENTRY(ELowPassGateMode::Follower, "FollowerDescription", "Follower", "FollowerTT", "The level of the input opens the gate, Attack Time and Decay Time set how fast it follows. No trigger needed")
+		DEFINE_METASOUND_ENUM_END()
+
+	DEFINE_METASOUND_ENUM_BEGIN(ELowPassGateOversampling, FEnumELowPassGateOversampling, "LowPassGateOversampling")
+		DEFINE_METASOUND_ENUM_ENTRY(ELowPassGateOversampling::None, "NoneDescription", "None", "NoneTT", "Filter and gate run at the graph rate"),
+		DEFINE_METASOUND_ENUM_ENTRY(ELowPassGateOversampling::TwoX, "TwoXDescription", "2x", "TwoXTT", "Filter and gate run at twice the graph rate, adds 19 samples of latency"),
+		DEFINE_METASOUND_ENUM_ENTRY(ELowPassGateOversampling::FourX, "FourXDescription", "4x", "FourXTT", "Filter and gate run at four times the graph rate, adds 29 samples of latency")
 		DEFINE_METASOUND_ENUM_END()
 
 	namespace LowPassGate
@@ -44,8 +50,14 @@ namespace Metasound
 		METASOUND_PARAM(InputDecayCurve, "Decay Curve", "1.0 = linear decay, <1.0 = exponential decay, >1.0 = logorithmic decay");
 		METASOUND_PARAM(InputAudio, "In", "Audio input");
 		METASOUND_PARAM(InputCutOff, "Cut Off", "Cut off frequency");
+		METASOUND_PARAM(InputResonance, "Resonance", "Q of the low pass filter, up to 10. At or below 0.5 the filter has no resonant peak");
 		METASOUND_PARAM(InputMode, "Mode", "Low Pass Gate Mode");
-		METASOUND_PARAM(InputEnvelope, "Envelope", "Envelope");
+		METASOUND_PARAM(InputCutOffModulation, "Cut Off Mod", "Per-sample cut off modulation in octaves, added to Cut Off");
+		METASOUND_PARAM(InputExcitationId, "Excitation ID", "Non-zero plays back hits pre-rendered for this excitation in FLowPassGateHitCache whenever the other inputs match. In is ignored while a cached hit plays");
+		METASOUND_PARAM(InputGateId, "Gate ID", "Non-zero lets gameplay code drive this gate through FLowPassGateControl or the Buchla Low Pass Gate Blueprint library. Values sent that way override the pins. Read once when the graph is built, later changes are ignored");
+		METASOUND_PARAM(InputOversampling, "Oversampling", "Runs the filter and gate above the graph rate to reduce aliasing from high cut offs and fast envelopes");
+		//Kept so graphs authored against 1.0 still load with their connections, the envelope is generated from Trigger now
+		METASOUND_PARAM(InputEnvelope, "Envelope", "Deprecated and ignored, the gate runs its own envelope from Trigger, Attack Time and Decay Time");
 
 		METASOUND_PARAM(OutputTrigger, "On Trigger", "Triggers when envelope is triggered");
 		METASOUND_PARAM(OutputOnDone, "On Done", "Triggers when envelope finishes");
@@ -53,158 +65,70 @@ namespace Metasound
 		METASOUND_PARAM(OutputAudio, "Out", "Output Audio");
 	}
 
-	//Envelope structs are from MetasoundADEnvelopeNode.cpp
-	//The original version is templated to work with either audio or float output
-	//Audio envelopes were not needed for this project, so only the float structs were used
-	struct FEnvelopeState
-	{
-		int32 CurrentSampleIndex = INDEX_NONE;
-		int32 AttackSampleCount = 1;
-		int32 DecaySampleCount = 1;
-		float AttackCurveFactor = 0.0f;
-		float DecayCurveFactor = 0.0f;
-		Audio::FExponentialEase EnvelopeEase;
-		float StartingEnvelopeValue = 0.0f;
-		float CurrentEnvelopeValue = 0.0f;
+	//Around 1.3ms at 48kHz, long enough that moving in or out of passthrough does not click
+	static constexpr int32 PassthroughFadeFrames = 64;
 
-		bool bLooping = false;
-		bool bHardReset = false;
+	//LowPass and Follower are driven by the input alone and never run the envelope or read the Trigger
+	static bool UsesEnvelope(ELowPassGateMode InMode)
+	{
+		return InMode != ELowPassGateMode::LowPass && InMode != ELowPassGateMode::Follower;
+	}
 
-		void Reset()
+	static int32 GetOversamplingFactor(ELowPassGateOversampling InOversampling)
+	{
+		switch (InOversampling)
 		{
-			CurrentSampleIndex = INDEX_NONE;
-			AttackSampleCount = 1;
-			DecaySampleCount = 1;
-
-			AttackCurveFactor = 0.0f;
-			DecayCurveFactor = 0.0f;
+		case ELowPassGateOversampling::TwoX:
+			return 2;
 
-			StartingEnvelopeValue = 0.0f;
-			CurrentEnvelopeValue = 0.0f;
+		case ELowPassGateOversampling::FourX:
+			return 4;
 
-			bLooping = false;
-			bHardReset = false;
-			EnvelopeEase.Init(0.f, 0.01f);
+		case ELowPassGateOversampling::None:
+		default:
+			return 1;
 		}
-	};
+	}
 
-	struct Envelope
+	template<int32 NumChannels>
+	SIZE_T TLowPassGateOperator<NumChannels>::GetAllocatedSize() const
 	{
-		static void GetNextEnvelopeOutput(FEnvelopeState& InState, int32 StartFrame, int32 EndFrame, TArray<int32>& OutFinishedFrames, float& OutEnvelopeValue)
+		//The outputs and scratch buffers are created by the operator, the inputs belong to whoever wrote them
+		SIZE_T Size = sizeof(*this);
+		Size += EnvelopeBuffer.Num() * sizeof(float);
+		Size += NumChannels * (sizeof(FAudioBuffer) + AudioOutputs[0]->Num() * sizeof(float));
+		Size += 3 * sizeof(FTrigger) + sizeof(float);
+		Size += FinishedFrames.GetAllocatedSize();
+		if (ControlQueue.IsValid())
 		{
-			// Don't need to do anything if we're not generating the envelope at the top of the block since this is a block-rate envelope
-			if (StartFrame > 0 || InState.CurrentSampleIndex == INDEX_NONE)
-			{
-				OutEnvelopeValue = 0.0f;
-				return;
-			}
-
-			// We are in attack
-			if (InState.CurrentSampleIndex < InState.AttackSampleCount)
-			{
-				if (InState.AttackSampleCount > 1)
-				{
-					float AttackFraction = (float)InState.CurrentSampleIndex++ / InState.AttackSampleCount;
-					OutEnvelopeValue = InState.StartingEnvelopeValue + (1.0f - InState.StartingEnvelopeValue) * FMath::Pow(AttackFraction, InState.AttackCurveFactor);
-				}
-				else
-				{
-					// Attack is effectively 0, skip Attack fade-in
-					InState.CurrentSampleIndex++;
-					OutEnvelopeValue = 1.f;
-				}
-			}
-			else
-			{
-				int32 TotalEnvSampleCount = (InState.AttackSampleCount + InState.DecaySampleCount);
-
-				// We are in Decay
-				if (InState.CurrentSampleIndex < TotalEnvSampleCount)
-				{
-					int32 SampleCountInDecayState = InState.CurrentSampleIndex++ - InState.AttackSampleCount;
-					float DecayFraction = (float)SampleCountInDecayState / InState.DecaySampleCount;
-					OutEnvelopeValue = 1.0f - FMath::Pow(DecayFraction, InState.DecayCurveFactor);
-				}
-				// We are looping so reset the sample index
-				else if (InState.bLooping)
-				{
-					InState.CurrentSampleIndex = 0;
-					OutFinishedFrames.Add(0);
-				}
-				else
-				{
-					// Envelope is done
-					InState.CurrentSampleIndex = INDEX_NONE;
-					OutEnvelopeValue = 0.0f;
-					OutFinishedFrames.Add(0);
-				}
-			}
+			Size += sizeof(FLowPassGateUpdateQueue) + FLowPassGateControl::QueueCapacity * sizeof(FLowPassGateUpdate);
+			Size += QueuedTriggerFrames.GetAllocatedSize();
 		}
-	};
-
-	class FLowPassGateOperator : public TExecutableOperator<FLowPassGateOperator>
-	{
-	public:
-		static const FNodeClassMetadata& GetNodeInfo();
-		static const FVertexInterface& GetVertexInterface();
-		static TUniquePtr<IOperator> CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors);
-
-		FLowPassGateOperator(const FOperatorSettings& InSettings,
-			const FTriggerReadRef& InTriggerIn,
-			const FTimeReadRef& InAttackTime,
-			const FTimeReadRef& InDecayTime,
-			const FFloatReadRef& InAttackCurveFactor,
-			const FFloatReadRef& InDecayCurveFactor,
-			const FAudioBufferReadRef& InAudioInput,
-			const FFloatReadRef& InCutOff,
-			const FEnumLowPassGateModeReadRef& InGateMode,
-			const FFloatReadRef& InEnvelopeValue);
-
-		virtual FDataReferenceCollection GetInputs() const override;
-		virtual FDataReferenceCollection GetOutputs() const override;
-
-		void UpdateParams();
-		void Execute();
-
-		void HandleLowPassFilter();
-		void CalculateEnvelope();
-
-	private:
-		FTriggerReadRef TriggerAttackIn;
-		FTimeReadRef AttackTime;
-		FTimeReadRef DecayTime;
-		FFloatReadRef AttackCurveFactor;
-		FFloatReadRef DecayCurveFactor;
-		FAudioBufferReadRef AudioInput;
-		FFloatReadRef CutOffFrequency;
-		FEnumLowPassGateModeReadRef Mode;
-		FFloatReadRef InEnvelope;
-
-		FTriggerWriteRef OnAttackTrigger;
-		FTriggerWriteRef OnDone;
-		TDataWriteReference<float> OutEnvelope;
-		FAudioBufferWriteRef AudioOutput;
-
-		float SampleRate = 0.0f;
-		int32 NumFramesPerBlock = 0;
-
-		FEnvelopeState EnvelopeState;
-		Audio::FStateVariableFilter VariableFilter;
-		float PreviousFrequency{ -1.f };
-		float PreviousResonance{ -1.f };
-		float PreviousBandStopControl{ -1.f };
-	};
+		return Size;
+	}
 
-	const FNodeClassMetadata& FLowPassGateOperator::GetNodeInfo()
+	template<int32 NumChannels>
+	const FNodeClassMetadata& TLowPassGateOperator<NumChannels>::GetNodeInfo()
 	{
 		auto CreateNodeClassMetadata = []()->FNodeClassMetadata
 		{
 			FNodeClassMetadata Info;
-			Info.ClassName = { FName("BuchlaBongo"), TEXT("Buchla Low Pass Gate"), FName("Audio") };
 			Info.MajorVersion = 1;
-			Info.MinorVersion = 0;
-			Info.DisplayName = METASOUND_LOCTEXT("LPGDisplayName", "Buchla Low Pass Gate");
-			Info.Description = METASOUND_LOCTEXT("LPGDescription", "Low Pass Gate");
+			if constexpr (NumChannels == 1)
+			{
+				Info.ClassName = { FName("BuchlaBongo"), TEXT("Buchla Low Pass Gate"), FName("Audio") };
+				Info.MinorVersion = 8;
+				Info.DisplayName = METASOUND_LOCTEXT("LPGDisplayName", "Buchla Low Pass Gate");
+				Info.Description = METASOUND_LOCTEXT("LPGDescription", "Low Pass Gate");
+			}
+			else
+			{
+				//1.1 gained the Resonance, Cut Off Mod, Oversampling and Gate ID pins of the mono gate
+				Info.ClassName = { FName("BuchlaBongo"), TEXT("Buchla Low Pass Gate"), FName(*FString::Printf(TEXT("%d Channels"), NumChannels)) };
+				Info.MinorVersion = 1;
+				Info.DisplayName = METASOUND_LOCTEXT_FORMAT("MultichannelDisplayName", "Buchla Low Pass Gate ({0} Channels)", NumChannels);
+				Info.Description = METASOUND_LOCTEXT("MultichannelDescription", "Low Pass Gate for multichannel audio, every channel shares one envelope and cut off and the Follower listens to the loudest channel");
+			}
 			Info.Author = TEXT("Declan Shields");
 			Info.DefaultInterface = GetVertexInterface();
 			Info.CategoryHierarchy.Emplace(NodeCategories::Filters);
@@ -217,34 +141,102 @@ namespace Metasound
 		return Info;
 	}
 
-	const FVertexInterface& FLowPassGateOperator::GetVertexInterface()
+	template<int32 NumChannels>
+	FVertexName TLowPassGateOperator<NumChannels>::GetInputAudioName(int32 InChannel)
+	{
+		using namespace LowPassGate;
+
+		if constexpr (NumChannels == 1)
+		{
+			return METASOUND_GET_PARAM_NAME(InputAudio);
+		}
+		else
+		{
+			//Numbered the same way the stock mixer nodes name their pins
+			return *FString::Printf(TEXT("In %d"), InChannel);
+		}
+	}
+
+	template<int32 NumChannels>
+	FVertexName TLowPassGateOperator<NumChannels>::GetOutputAudioName(int32 InChannel)
+	{
+		using namespace LowPassGate;
+
+		if constexpr (NumChannels == 1)
+		{
+			return METASOUND_GET_PARAM_NAME(OutputAudio);
+		}
+		else
+		{
+			return *FString::Printf(TEXT("Out %d"), InChannel);
+		}
+	}
+
+	template<int32 NumChannels>
+	const FVertexInterface& TLowPassGateOperator<NumChannels>::GetVertexInterface()
 	{
 		using namespace LowPassGate;
 
-		static const FVertexInterface Interface(
-			FInputVertexInterface(
+		auto CreateVertexInterface = []()->FVertexInterface
+		{
+			FInputVertexInterface InputInterface(
 				TInputDataVertex<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputTrigger)),
 				TInputDataVertex<FTime>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputAttackTime), 0.01f),
 				TInputDataVertex<FTime>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputDecayTime), 0.1f),
 				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputAttackCurve), 1.0f),
-				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputDecayCurve), 0.5f),
-				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputAudio)),
-				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputCutOff), 1500.0f),
-				TInputDataVertex<FEnumELowPassGateMode>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputMode)),
-				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputEnvelope))
-			),
-			FOutputVertexInterface(
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputDecayCurve), 0.5f)
+			);
+
+			FOutputVertexInterface OutputInterface(
 				TOutputDataVertex<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputTrigger)),
 				TOutputDataVertex<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputOnDone)),
-				TOutputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputEnvelope)),
-				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputAudio))
-			)
-		);
+				TOutputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputEnvelope))
+			);
+
+			if constexpr (NumChannels == 1)
+			{
+				InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputAudio)));
+				OutputInterface.Add(TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputAudio)));
+			}
+			else
+			{
+				for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+				{
+					const FDataVertexMetadata InputMetadata{ METASOUND_LOCTEXT_FORMAT("MultichannelInTT", "Audio input for channel {0}", Channel), METASOUND_LOCTEXT_FORMAT("MultichannelInName", "In {0}", Channel) };
+					InputInterface.Add(TInputDataVertex<FAudioBuffer>(GetInputAudioName(Channel), InputMetadata));
+
+					const FDataVertexMetadata OutputMetadata{ METASOUND_LOCTEXT_FORMAT("MultichannelOutTT", "Output audio for channel {0}", Channel), METASOUND_LOCTEXT_FORMAT("MultichannelOutName", "Out {0}", Channel) };
+					OutputInterface.Add(TOutputDataVertex<FAudioBuffer>(GetOutputAudioName(Channel), OutputMetadata));
+				}
+			}
+
+			InputInterface.Add(TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputCutOff), 1500.0f));
+			InputInterface.Add(TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputResonance), 0.0f));
+			InputInterface.Add(TInputDataVertex<FEnumELowPassGateMode>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputMode)));
+			InputInterface.Add(TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputCutOffModulation)));
+			InputInterface.Add(TInputDataVertex<FEnumELowPassGateOversampling>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputOversampling)));
+
+			//Cached hits are rendered mono, and only the mono gate ever had the old Envelope pin
+			if constexpr (NumChannels == 1)
+			{
+				InputInterface.Add(TInputDataVertex<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputExcitationId), 0));
+			}
+			InputInterface.Add(TInputDataVertex<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputGateId), 0));
+			if constexpr (NumChannels == 1)
+			{
+				InputInterface.Add(TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA_ADVANCED(InputEnvelope), 0.0f));
+			}
+
+			return FVertexInterface(InputInterface, OutputInterface);
+		};
+
+		static const FVertexInterface Interface = CreateVertexInterface();
 
 		return Interface;
 	}
 
-	TUniquePtr<IOperator> FLowPassGateOperator::CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors)
+	template<int32 NumChannels>
+	TUniquePtr<IOperator> TLowPassGateOperator<NumChannels>::CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors)
 	{
 		using namespace LowPassGate;
 
@@ -255,44 +247,223 @@ namespace Metasound
 		FTimeReadRef DecayTime = InParams.InputDataReferences.GetDataReadReferenceOrConstructWithVertexDefault<FTime>(InputInterface, METASOUND_GET_PARAM_NAME(InputDecayTime), InParams.OperatorSettings);
 		FFloatReadRef AttackCurveFactor = InParams.InputDataReferences.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InputAttackCurve), InParams.OperatorSettings);
 		FFloatReadRef DecayCurveFactor = InParams.InputDataReferences.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InputDecayCurve), InParams.OperatorSettings);
-		FAudioBufferReadRef AudioIn = InParams.InputDataReferences.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InputAudio), InParams.OperatorSettings);
 		FFloatReadRef CutOff = InParams.InputDataReferences.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InputCutOff), InParams.OperatorSettings);
+		FFloatReadRef InResonance = InParams.InputDataReferences.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InputResonance), InParams.OperatorSettings);
 		FEnumLowPassGateModeReadRef InMode = InParams.InputDataReferences.GetDataReadReferenceOrConstruct<FEnumELowPassGateMode>(METASOUND_GET_PARAM_NAME(InputMode));
-		FFloatReadRef EnvelopeIn = InParams.InputDataReferences.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InputEnvelope), InParams.OperatorSettings);
-		return MakeUnique<FLowPassGateOperator>(InParams.OperatorSettings, TriggerIn, AttackTime, DecayTime, AttackCurveFactor, DecayCurveFactor, AudioIn, CutOff, InMode, EnvelopeIn);
+		FAudioBufferReadRef CutOffMod = InParams.InputDataReferences.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InputCutOffModulation), InParams.OperatorSettings);
+		FEnumLowPassGateOversamplingReadRef InOversampling = InParams.InputDataReferences.GetDataReadReferenceOrConstruct<FEnumELowPassGateOversampling>(METASOUND_GET_PARAM_NAME(InputOversampling));
+		FInt32ReadRef InGateId = InParams.InputDataReferences.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InputGateId), InParams.OperatorSettings);
+		const bool bHasCutOffMod = InParams.InputDataReferences.ContainsDataReadReference<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InputCutOffModulation));
+		const bool bHasTrigger = InParams.InputDataReferences.ContainsDataReadReference<FTrigger>(METASOUND_GET_PARAM_NAME(InputTrigger));
+
+		TArray<FAudioBufferReadRef> AudioIns;
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			AudioIns.Add(InParams.InputDataReferences.GetDataReadReferenceOrConstruct<FAudioBuffer>(GetInputAudioName(Channel), InParams.OperatorSettings));
+		}
+
+		//The multichannel gates have no pins for these, they read as an Excitation ID of 0 and an unconnected Envelope
+		FInt32ReadRef InExcitationId = FInt32ReadRef::CreateNew(0);
+		FFloatReadRef DeprecatedEnvelope = FFloatReadRef::CreateNew(0.0f);
+		if constexpr (NumChannels == 1)
+		{
+			InExcitationId = InParams.InputDataReferences.GetDataReadReferenceOrConstructWithVertexDefault<int32>(InputInterface, METASOUND_GET_PARAM_NAME(InputExcitationId), InParams.OperatorSettings);
+			DeprecatedEnvelope = InParams.InputDataReferences.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InputEnvelope), InParams.OperatorSettings);
+		}
+
+		return MakeUnique<TLowPassGateOperator<NumChannels>>(InParams.OperatorSettings, TriggerIn, AttackTime, DecayTime, AttackCurveFactor, DecayCurveFactor, AudioIns, CutOff, InResonance, InMode, CutOffMod, InOversampling, InExcitationId, InGateId, DeprecatedEnvelope, bHasCutOffMod, bHasTrigger);
 	}
 
-	FLowPassGateOperator::FLowPassGateOperator(const FOperatorSettings& InSettings,
+	template<int32 NumChannels>
+	TLowPassGateOperator<NumChannels>::TLowPassGateOperator(const FOperatorSettings& InSettings,
 		const FTriggerReadRef& InTriggerIn,
 		const FTimeReadRef& InAttackTime,
 		const FTimeReadRef& InDecayTime,
 		const FFloatReadRef& InAttackCurveFactor,
 		const FFloatReadRef& InDecayCurveFactor,
-		const FAudioBufferReadRef& InAudioInput,
+		const TArray<FAudioBufferReadRef>& InAudioInputs,
 		const FFloatReadRef& InCutOff,
+		const FFloatReadRef& InResonance,
 		const FEnumLowPassGateModeReadRef& InGateMode,
-		const FFloatReadRef& InEnvelopeValue) : TriggerAttackIn(InTriggerIn)
+		const FAudioBufferReadRef& InCutOffModulation,
+		const FEnumLowPassGateOversamplingReadRef& InOversampling,
+		const FInt32ReadRef& InExcitationId,
+		const FInt32ReadRef& InGateId,
+		const FFloatReadRef& InDeprecatedEnvelope,
+		bool bInHasCutOffModulation,
+		bool bInHasTriggerInput) : TriggerAttackIn(InTriggerIn)
 		, AttackTime(InAttackTime)
 		, DecayTime(InDecayTime)
 		, AttackCurveFactor(InAttackCurveFactor)
 		, DecayCurveFactor(InDecayCurveFactor)
-		, AudioInput(InAudioInput)
+		, AudioInputs(InAudioInputs)
 		, CutOffFrequency(InCutOff)
+		, Resonance(InResonance)
 		, Mode(InGateMode)
-		, InEnvelope(InEnvelopeValue)
+		, CutOffModulation(InCutOffModulation)
+		, Oversampling(InOversampling)
+		, ExcitationId(InExcitationId)
+		, GateId(InGateId)
+		, DeprecatedEnvelope(InDeprecatedEnvelope)
 		, OnAttackTrigger(TDataWriteReferenceFactory<FTrigger>::CreateAny(InSettings))
 		, OnDone(TDataWriteReferenceFactory<FTrigger>::CreateAny(InSettings))
 		, OutEnvelope(TDataWriteReferenceFactory<float>::CreateAny(InSettings))
-		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+		, MergedTrigger(FTriggerWriteRef::CreateNew(InSettings))
+		, EnvelopeBuffer(InSettings)
+		, CutOffTable(LowPassGateDSP::FCutOffTable::Get(InSettings.GetSampleRate()))
+		, VactrolTable(LowPassGateDSP::FVactrolTable::Get(InSettings.GetSampleRate()))
+	{
+		check(AudioInputs.Num() == NumChannels);
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			AudioOutputs.Add(FAudioBufferWriteRef::CreateNew(InSettings));
+		}
+
+		Hot.bHasCutOffModulation = bInHasCutOffModulation;
+		Hot.bHasTriggerInput = bInHasTriggerInput;
+
+		//The envelope can only finish once per trigger range, the extra slack is headroom
+		FinishedFrames.Reserve(4);
+		FetchOversampledTables(InSettings.GetSampleRate());
+
+		//Registering takes a lock and allocates, so the Gate ID is only read here, never on the render thread
+		//Registered before ResetState, which sizes the trigger merge buffers only for gates with a queue
+		ControlGateId = *GateId;
+		if (ControlGateId != 0)
+		{
+			ControlQueue = FLowPassGateControl::Get().Register(ControlGateId);
+		}
+
+		//Counted as active until ResetState decides otherwise
+		INC_DWORD_STAT(STAT_BuchlaBongo_ActiveGates);
+		ResetState(InSettings);
+	}
+
+	template<int32 NumChannels>
+	TLowPassGateOperator<NumChannels>::~TLowPassGateOperator()
+	{
+		if (ControlQueue.IsValid())
+		{
+			FLowPassGateControl::Get().Unregister(ControlGateId, ControlQueue);
+		}
+
+		if (Hot.bIsSleeping)
+		{
+			DEC_DWORD_STAT(STAT_BuchlaBongo_SleepingGates);
+		}
+		else
+		{
+			DEC_DWORD_STAT(STAT_BuchlaBongo_ActiveGates);
+		}
+	}
+
+	template<int32 NumChannels>
+	void TLowPassGateOperator<NumChannels>::Reset(const FOperatorSettings& InSettings)
+	{
+		//Pooled operators can be handed to a graph running at a different rate, fetch the matching tables
+		if (!FMath::IsNearlyEqual(Hot.SampleRate, InSettings.GetSampleRate()))
+		{
+			CutOffTable = LowPassGateDSP::FCutOffTable::Get(InSettings.GetSampleRate());
+			VactrolTable = LowPassGateDSP::FVactrolTable::Get(InSettings.GetSampleRate());
+			FetchOversampledTables(InSettings.GetSampleRate());
+		}
+
+		//Assigned through the references rather than recreated, whatever reads the outputs keeps reading the same objects
+		if (Hot.NumFramesPerBlock != InSettings.GetNumFramesPerBlock())
+		{
+			for (FAudioBufferWriteRef& AudioOutput : AudioOutputs)
+			{
+				*AudioOutput = FAudioBuffer(InSettings);
+			}
+			EnvelopeBuffer = FAudioBuffer(InSettings);
+			*OnAttackTrigger = FTrigger(InSettings);
+			*OnDone = FTrigger(InSettings);
+			*MergedTrigger = FTrigger(InSettings);
+		}
+
+		ResetState(InSettings);
+	}
+
+	template<int32 NumChannels>
+	void TLowPassGateOperator<NumChannels>::FetchOversampledTables(float InSampleRate)
+	{
+		for (int32 Index = 0; Index < UE_ARRAY_COUNT(OversampledCutOffTables); ++Index)
+		{
+			const float OversampledRate = InSampleRate * (2 << Index);
+			OversampledCutOffTables[Index] = LowPassGateDSP::FCutOffTable::Get(OversampledRate);
+			OversampledVactrolTables[Index] = LowPassGateDSP::FVactrolTable::Get(OversampledRate);
+		}
+	}
+
+	template<int32 NumChannels>
+	void TLowPassGateOperator<NumChannels>::ResetState(const FOperatorSettings& InSettings)
 	{
-		NumFramesPerBlock = InSettings.GetNumFramesPerBlock();
-		EnvelopeState.EnvelopeEase.SetEaseFactor(0.01f);
-		SampleRate = InSettings.GetSampleRate();
-		VariableFilter.Init(SampleRate, 1);
-		VariableFilter.SetFilterType(Audio::EFilter::LowPass);
+		Hot.SampleRate = InSettings.GetSampleRate();
+		Hot.NumFramesPerBlock = InSettings.GetNumFramesPerBlock();
+
+		Hot.EnvelopeState.Reset();
+		EnvelopeBuffer.Zero();
+		Hot.FilterCoefficients = LowPassGateDSP::FSVFCoefficients();
+		ResetFilterStates();
+		Hot.VactrolLevel = 0.0f;
+		Hot.FollowerLevel = 0.0f;
+		PreviousFollowerAttackTime = -1.0f;
+		PreviousFollowerDecayTime = -1.0f;
+		for (LowPassGateDSP::FOversampler& Oversampler : Oversamplers)
+		{
+			Oversampler.SetFactor(GetOversamplingFactor(*Oversampling));
+		}
+		Hot.PreviousEnvelopeValue = 0.0f;
+		CachedHit = FCachedHitVoice();
+		FadingHit = FCachedHitVoice();
+		Hot.bIsCulled = false;
+		BudgetVoice.ResetPeak();
+		BudgetVoice.LeaveRanking();
+
+		ControlCutOff = -1.0f;
+		ControlAttackTime = -1.0f;
+		ControlDecayTime = -1.0f;
+		bHasControlMode = false;
+		if (ControlQueue.IsValid())
+		{
+			//Room for a full queue and one trigger on every frame of the block, both no-ops unless the block size grew
+			//FTrigger has nothing like Reserve, triggering each frame once grows its frame list and Reset() keeps the allocation
+			QueuedTriggerFrames.Reserve(FLowPassGateControl::QueueCapacity + Hot.NumFramesPerBlock);
+			for (int32 Frame = 0; Frame < Hot.NumFramesPerBlock; ++Frame)
+			{
+				MergedTrigger->TriggerFrame(Frame);
+			}
+		}
+		MergedTrigger->Reset();
+		BlockTrigger = &(*TriggerAttackIn);
+
+		//Forces every parameter to be recomputed on the first block
+		Hot.PreviousFrequency = -1.0f;
+		Hot.PreviousResonance = -1.0f;
+		Hot.PreviousGateGain = -1.0f;
+		PreviousAttackTime = -1.0f;
+		PreviousDecayTime = -1.0f;
+		PreviousAttackCurve = -1.0f;
+		PreviousDecayCurve = -1.0f;
+		Hot.CutOffStartOctaves = 0.0f;
+		Hot.CutOffEndOctaves = 0.0f;
+		Hot.bIsCutOffRamping = false;
+
+		OnAttackTrigger->Reset();
+		OnDone->Reset();
+		*OutEnvelope = 0.0f;
+		ZeroOutputs();
+
+		Hot.ActiveMode = ELowPassGateMode::LowPass;
+		SelectExecuteMode(GetModeInput());
+
+		//An untriggered gate in an envelope mode is silent from the first block, skip straight to sleep
+		SetSleeping(!Hot.bHasTriggerInput && UsesEnvelope(Hot.ActiveMode));
+		Hot.bIsOutputCleared = true;
 	}
 
-	FDataReferenceCollection FLowPassGateOperator::GetInputs() const
+	template<int32 NumChannels>
+	FDataReferenceCollection TLowPassGateOperator<NumChannels>::GetInputs() const
 	{
 		using namespace LowPassGate;
 
@@ -302,15 +473,27 @@ namespace Metasound
 		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputDecayTime), DecayTime);
 		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputAttackCurve), AttackCurveFactor);
 		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputDecayCurve), DecayCurveFactor);
-		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputAudio), AudioInput);
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			Inputs.AddDataReadReference(GetInputAudioName(Channel), AudioInputs[Channel]);
+		}
 		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputCutOff), CutOffFrequency);
+		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputResonance), Resonance);
 		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputMode), Mode);
-		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputEnvelope), InEnvelope);
+		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputCutOffModulation), CutOffModulation);
+		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputOversampling), Oversampling);
+		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputGateId), GateId);
+		if constexpr (NumChannels == 1)
+		{
+			Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputExcitationId), ExcitationId);
+			Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputEnvelope), DeprecatedEnvelope);
+		}
 
 		return Inputs;
 	}
 
-	FDataReferenceCollection FLowPassGateOperator::GetOutputs() const
+	template<int32 NumChannels>
+	FDataReferenceCollection TLowPassGateOperator<NumChannels>::GetOutputs() const
 	{
 		using namespace LowPassGate;
 
@@ -318,162 +501,1250 @@ namespace Metasound
 		Outputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputTrigger), OnAttackTrigger);
 		Outputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputOnDone), OnDone);
 		Outputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputEnvelope), OutEnvelope);
-		Outputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputAudio), AudioOutput);
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			Outputs.AddDataReadReference(GetOutputAudioName(Channel), AudioOutputs[Channel]);
+		}
 
 		return Outputs;
 	}
 
-	void FLowPassGateOperator::UpdateParams()
+	template<int32 NumChannels>
+	void TLowPassGateOperator<NumChannels>::UpdateParams()
 	{
 		//Code from MetasoundADEnvelopeNode.cpp
-		float AttackTimeSeconds = AttackTime->GetSeconds();
-		float DecayTimeSeconds = DecayTime->GetSeconds();
-		EnvelopeState.AttackSampleCount = FMath::Max(1, SampleRate * AttackTimeSeconds);
-		EnvelopeState.DecaySampleCount = FMath::Max(1, SampleRate * DecayTimeSeconds);
-		EnvelopeState.AttackCurveFactor = FMath::Max(KINDA_SMALL_NUMBER, *AttackCurveFactor);
-		EnvelopeState.DecayCurveFactor = FMath::Max(KINDA_SMALL_NUMBER, *DecayCurveFactor);
+		//Like HandleLowPassFilter, nothing is recomputed unless an input has actually changed
+		const int32 MinControlRate = GetDegradation() >= ELowPassGateDegradation::ControlRateEnvelope ? FLowPassGateBudget::DegradedControlRate : 1;
+		Hot.EnvelopeState.ControlRate = FMath::Max(BuchlaBongoCVars::GetEnvelopeControlRate(), MinControlRate);
+
+		const float AttackTimeSeconds = GetAttackSeconds();
+		const float DecayTimeSeconds = GetDecaySeconds();
+		if (!FMath::IsNearlyEqual(PreviousAttackTime, AttackTimeSeconds) || !FMath::IsNearlyEqual(PreviousDecayTime, DecayTimeSeconds))
+		{
+			Hot.EnvelopeState.AttackSampleCount = FMath::Max(1, Hot.SampleRate * AttackTimeSeconds);
+			Hot.EnvelopeState.DecaySampleCount = FMath::Max(1, Hot.SampleRate * DecayTimeSeconds);
+
+			PreviousAttackTime = AttackTimeSeconds;
+			PreviousDecayTime = DecayTimeSeconds;
+		}
+
+		const float CurrentAttackCurve = FMath::Max(KINDA_SMALL_NUMBER, *AttackCurveFactor);
+		const float CurrentDecayCurve = FMath::Max(KINDA_SMALL_NUMBER, *DecayCurveFactor);
+		if (!FMath::IsNearlyEqual(PreviousAttackCurve, CurrentAttackCurve) || !FMath::IsNearlyEqual(PreviousDecayCurve, CurrentDecayCurve))
+		{
+			//Curve changes are ramped across the block so a sounding envelope does not jump
+			Hot.EnvelopeState.SetCurveFactors(CurrentAttackCurve, CurrentDecayCurve, Hot.NumFramesPerBlock);
+
+			PreviousAttackCurve = CurrentAttackCurve;
+			PreviousDecayCurve = CurrentDecayCurve;
+		}
 	}
 
-	void FLowPassGateOperator::CalculateEnvelope()
+	template<int32 NumChannels>
+	bool TLowPassGateOperator<NumChannels>::CalculateEnvelope(float* OutEnvelopeValues)
 	{
+		SCOPE_CYCLE_COUNTER(STAT_BuchlaBongo_LPGEnvelope);
+
 		//Code Below Taken from MetasoundADEnvelopeNode.cpp
-		//but with UpdateParams() call replaced with the code
 		OnAttackTrigger->AdvanceBlock();
 		OnDone->AdvanceBlock();
 
-		float AttackTimeSeconds = AttackTime->GetSeconds();
-		float DecayTimeSeconds = DecayTime->GetSeconds();
-		EnvelopeState.AttackSampleCount = FMath::Max(1, SampleRate * AttackTimeSeconds);
-		EnvelopeState.DecaySampleCount = FMath::Max(1, SampleRate * DecayTimeSeconds);
-		EnvelopeState.AttackCurveFactor = FMath::Max(KINDA_SMALL_NUMBER, *AttackCurveFactor);
-		EnvelopeState.DecayCurveFactor = FMath::Max(KINDA_SMALL_NUMBER, *DecayCurveFactor);
+		//Nothing can happen this block, skip the parameter update and the trigger ranges entirely
+		if (Hot.EnvelopeState.CurrentSampleIndex == INDEX_NONE && !BlockTrigger->IsTriggeredInBlock())
+		{
+			FMemory::Memzero(OutEnvelopeValues, sizeof(float) * Hot.NumFramesPerBlock);
+			Hot.EnvelopeState.CurrentEnvelopeValue = 0.0f;
+			*OutEnvelope = 0.0f;
+			return false;
+		}
 
-		TriggerAttackIn->ExecuteBlock(
-			[&](int32 StartFrame, int32 EndFrame)
-			{
-				TArray<int32> FinishedFrames;
-				Envelope::GetNextEnvelopeOutput(EnvelopeState, StartFrame, EndFrame, FinishedFrames, *OutEnvelope);
+		//Done once per block, the trigger ranges below all share the same parameters
+		UpdateParams();
 
+		const int32 NumTriggers = BlockTrigger->NumTriggeredInBlock();
+		if (NumTriggers > 0)
+		{
+			INC_DWORD_STAT_BY(STAT_BuchlaBongo_Triggers, NumTriggers);
+			CSV_CUSTOM_STAT(BuchlaBongo, LPGTriggers, NumTriggers, ECsvCustomStatOp::Accumulate);
+		}
+
+		//One pass over the block, rendering up to each trigger and then restarting the envelope in place
+		//A trigger only costs the restart, so a roll with a trigger on every frame renders no more samples than a single hit
+		//Triggers on the same frame restart the envelope once
+		int32 Frame = 0;
+		for (int32 TriggerIndex = 0; TriggerIndex <= NumTriggers; ++TriggerIndex)
+		{
+			const int32 EndFrame = TriggerIndex < NumTriggers ? FMath::Clamp((*BlockTrigger)[TriggerIndex], Frame, Hot.NumFramesPerBlock) : Hot.NumFramesPerBlock;
+
+			if (EndFrame > Frame)
+			{
+				FinishedFrames.Reset();
+				Envelope::GetNextEnvelopeOutput(Hot.EnvelopeState, Frame, EndFrame, FinishedFrames, OutEnvelopeValues);
 				for (int32 FrameFinished : FinishedFrames)
 				{
 					OnDone->TriggerFrame(FrameFinished);
 				}
-			},
-			[&](int32 StartFrame, int32 EndFrame)
-			{
-				float AttackTimeSeconds = AttackTime->GetSeconds();
-				float DecayTimeSeconds = DecayTime->GetSeconds();
-				EnvelopeState.AttackSampleCount = FMath::Max(1, SampleRate * AttackTimeSeconds);
-				EnvelopeState.DecaySampleCount = FMath::Max(1, SampleRate * DecayTimeSeconds);
-				EnvelopeState.AttackCurveFactor = FMath::Max(KINDA_SMALL_NUMBER, *AttackCurveFactor);
-				EnvelopeState.DecayCurveFactor = FMath::Max(KINDA_SMALL_NUMBER, *DecayCurveFactor);
-
-				EnvelopeState.CurrentSampleIndex = 0;
-				EnvelopeState.StartingEnvelopeValue = EnvelopeState.CurrentEnvelopeValue;
-				EnvelopeState.EnvelopeEase.SetValue(EnvelopeState.StartingEnvelopeValue, true);
-
-				TArray<int32> FinishedFrames;
-				Envelope::GetNextEnvelopeOutput(EnvelopeState, StartFrame, EndFrame, FinishedFrames, *OutEnvelope);
-				for (int32 FrameFinished : FinishedFrames)
-				{
-					OnDone->TriggerFrame(FrameFinished);
-				}
-				OnAttackTrigger->TriggerFrame(StartFrame);
+				Frame = EndFrame;
+			}
+			else if (TriggerIndex > 0 && EndFrame == (*BlockTrigger)[TriggerIndex - 1])
+			{
+				continue;
+			}
+
+			if (TriggerIndex < NumTriggers && EndFrame < Hot.NumFramesPerBlock)
+			{
+				Envelope::Retrigger(Hot.EnvelopeState);
+				OnAttackTrigger->TriggerFrame(EndFrame);
 			}
-		);
+		}
+
+		*OutEnvelope = Hot.EnvelopeState.CurrentEnvelopeValue;
+
+		return true;
 	}
 
-	void FLowPassGateOperator::HandleLowPassFilter()
+	template<int32 NumChannels>
+	void TLowPassGateOperator<NumChannels>::HandleLowPassFilter()
 	{
 		//Code below taken from MetasoundBasicFilters.cpp
-		const float CurrentFrequency = FMath::Clamp(*CutOffFrequency, 0.f, (0.5f * SampleRate));
-		const float CurrentResonance = FMath::Clamp(0.f, 0.f, 10.f);
-		const float CurrentBandStopControl = FMath::Clamp(0.f, 0.f, 1.f);
+		const float CurrentFrequency = FMath::Clamp(GetCutOffInput(), 0.f, (0.5f * Hot.SampleRate));
+		const float CurrentResonance = FMath::Clamp(*Resonance, 0.f, 10.f);
 
-		bool bNeedsUpdate =
-			(!FMath::IsNearlyEqual(PreviousFrequency, CurrentFrequency))
-			|| (!FMath::IsNearlyEqual(PreviousResonance, CurrentResonance))
-			|| (!FMath::IsNearlyEqual(PreviousBandStopControl, CurrentBandStopControl));
+		//Only the low pass output of the filter is used, so there is no band stop control to track
+		//The cached values are the last ones the coefficients were built from, so exact compares are enough to find a change
+		//The -1 the cache is reset to never matches, which forces the first update
+		const bool bFrequencyChanged = CurrentFrequency != Hot.PreviousFrequency;
+		const bool bResonanceChanged = CurrentResonance != Hot.PreviousResonance;
 
-		if (bNeedsUpdate)
+		//One coefficient update per block covers cut off and resonance changing together
+		if (bFrequencyChanged || bResonanceChanged)
 		{
-			VariableFilter.SetQ(CurrentResonance);
-			VariableFilter.SetFrequency(CurrentFrequency);
-			VariableFilter.SetBandStopControl(CurrentBandStopControl);
+			SCOPE_CYCLE_COUNTER(STAT_BuchlaBongo_LPGFilterUpdate);
+			INC_DWORD_STAT(STAT_BuchlaBongo_CoefficientUpdates);
+			CSV_CUSTOM_STAT(BuchlaBongo, LPGCoefficientUpdates, 1, ECsvCustomStatOp::Accumulate);
+
+			Hot.FilterCoefficients.Set(CurrentFrequency, CurrentResonance, Hot.SampleRate * GetActiveOversamplingFactor());
+			Hot.PreviousResonance = CurrentResonance;
+		}
 
-			VariableFilter.Update();
+		if (bFrequencyChanged)
+		{
+			//The first block jumps straight to the cut off, later changes glide to it across the block
+			//The per-sample kernels keep the resonance from the update above and only replace G
+			const float TargetOctaves = LowPassGateDSP::FCutOffTable::FrequencyToOctaves(CurrentFrequency);
+			Hot.bIsCutOffRamping = Hot.PreviousFrequency >= 0.0f;
+			Hot.CutOffStartOctaves = Hot.bIsCutOffRamping ? Hot.CutOffEndOctaves : TargetOctaves;
+			Hot.CutOffEndOctaves = TargetOctaves;
 
-			PreviousFrequency = CurrentFrequency;
-			PreviousResonance = CurrentResonance;
-			PreviousBandStopControl = CurrentBandStopControl;
+			Hot.PreviousFrequency = CurrentFrequency;
+		}
+		else
+		{
+			Hot.bIsCutOffRamping = false;
+			Hot.CutOffStartOctaves = Hot.CutOffEndOctaves;
 		}
 	}
 
-	void FLowPassGateOperator::Execute()
+	template<int32 NumChannels>
+	template<bool bCutOffModulated, bool bApplyGate>
+	void TLowPassGateOperator<NumChannels>::ProcessFilterBlock(const float* const* InAudio, float* const* OutAudio, int32 InNumSamples, const float* InEnvelopeValues, float InStartGain, float InEndGain)
 	{
-		if (*Mode == ELowPassGateMode::LowPass)
+		LowPassGateDSP::FSVFCoefficients Coefficients = Hot.FilterCoefficients;
+		LowPassGateDSP::FSVFState States[NumChannels];
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
 		{
-			//Uses FVariableStateFilter to pass the input audio through a low pass filter
-			HandleLowPassFilter();
-			VariableFilter.ProcessAudio(AudioInput->GetData(), AudioInput->Num(), AudioOutput->GetData());
+			States[Channel] = Hot.FilterStates[Channel];
 		}
-		else if (*Mode == ELowPassGateMode::VCA)
+
+		//Modulation is applied in octaves around the cut off, which is ramped when it changed this block
+		//G comes from the shared table
+		[[maybe_unused]] const float OctaveStep = (Hot.CutOffEndOctaves - Hot.CutOffStartOctaves) / InNumSamples;
+		[[maybe_unused]] float BaseOctaves = Hot.CutOffStartOctaves;
+		[[maybe_unused]] const float* ModulationValues = CutOffModulation->GetData();
+		[[maybe_unused]] const LowPassGateDSP::FCutOffTable& Table = *CutOffTable;
+
+		const float GainDelta = InNumSamples > 1 ? (InEndGain - InStartGain) / (InNumSamples - 1) : 0.0f;
+		float Gain = InStartGain;
+
+		//The cut off and the gain are worked out once per frame for every channel
+		auto AdvanceFrame = [&](int32 i) -> float
+		{
+			if constexpr (bCutOffModulated)
+			{
+				BaseOctaves += OctaveStep;
+				Coefficients.SetG(Table.GetG(BaseOctaves + ModulationValues[i]));
+			}
+
+			if constexpr (bApplyGate)
+			{
+				const float SampleGain = InEnvelopeValues[i] * Gain;
+				Gain += GainDelta;
+				return SampleGain;
+			}
+			else
+			{
+				return 1.0f;
+			}
+		};
+
+		int32 i = 0;
+		if constexpr (bFilterInLanes)
 		{
-			//Uses FEnvelope
-			CalculateEnvelope();
+			i = LowPassGateDSP::ProcessLowPassLanes<NumChannels, bApplyGate>(States, Coefficients, InAudio, OutAudio, InNumSamples, AdvanceFrame);
+		}
 
-			//Input Audio is multiplied by an envelope value that is input to the node
-			//Original functionality was supposed to have an internal envelope generator
-			//However it had issues that I could not diagnose
+		for (; i < InNumSamples; ++i)
+		{
+			[[maybe_unused]] const float SampleGain = AdvanceFrame(i);
 
-			const float* InputAudio = AudioInput->GetData();
-			float* OutputAudio = AudioOutput->GetData();
-			for (int i = 0; i < AudioInput->Num(); ++i)
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
 			{
-				//OutputAudio[i] = InputAudio[i] * (*OutEnvelope);
-				OutputAudio[i] = InputAudio[i] * (*InEnvelope);
+				const float Filtered = LowPassGateDSP::ProcessLowPassSample(Coefficients, States[Channel], InAudio[Channel][i]);
+
+				if constexpr (bApplyGate)
+				{
+					OutAudio[Channel][i] = Filtered * SampleGain;
+				}
+				else
+				{
+					OutAudio[Channel][i] = Filtered;
+				}
 			}
 		}
-		else if (*Mode == ELowPassGateMode::Both)
+
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			States[Channel].FlushDenormals();
+			Hot.FilterStates[Channel] = States[Channel];
+		}
+	}
+
+	template<int32 NumChannels>
+	template<bool bApplyGate>
+	void TLowPassGateOperator<NumChannels>::ProcessFilter(const float* const* InAudio, float* const* OutAudio, int32 InNumSamples, const float* InEnvelopeValues, float InStartGain, float InEndGain)
+	{
+		//An unconnected Cut Off Mod reads as silence, so the same kernel also handles a plain cut off ramp
+		if (Hot.bHasCutOffModulation || Hot.bIsCutOffRamping)
+		{
+			ProcessFilterBlock<true, bApplyGate>(InAudio, OutAudio, InNumSamples, InEnvelopeValues, InStartGain, InEndGain);
+		}
+		else
 		{
-			//This code follows the pure Metasound Node prototype of the Buchla Bongo
-			//The Cut Off Frequency is clamped between a value of 0-1
-			TRange<float> InRange = TRange<float>(0.0f, 1500.0f);
-			TRange<float> OutRange = TRange<float>(0.0f, 1.0f);
-			float ClampedFreq = FMath::GetMappedRangeValueClamped(InRange, OutRange, *CutOffFrequency);
+			ProcessFilterBlock<false, bApplyGate>(InAudio, OutAudio, InNumSamples, InEnvelopeValues, InStartGain, InEndGain);
+		}
+	}
 
-			float* OutputAudio = AudioOutput->GetData();
-			const float* InputAudio = AudioInput->GetData();
+	template<int32 NumChannels>
+	template<bool bCutOffModulated>
+	void TLowPassGateOperator<NumChannels>::ProcessVactrolBlock(const float* const* InAudio, float* const* OutAudio, int32 InNumSamples, const float* InEnvelopeValues)
+	{
+		using namespace LowPassGateDSP;
 
-			//The audio is then passed through a low pass filter. This is done first to avoid any adverse interactions 
-			//Between the Envelope Generator and the filter
-			HandleLowPassFilter();
-			VariableFilter.ProcessAudio(AudioInput->GetData(), AudioInput->Num(), AudioOutput->GetData());
+		FSVFCoefficients Coefficients = Hot.FilterCoefficients;
+		FSVFState States[NumChannels];
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			States[Channel] = Hot.FilterStates[Channel];
+		}
+		float Level = Hot.VactrolLevel;
+
+		//When the cell is fully lit the filter sits at the Cut Off, it closes by CutOffRangeOctaves as the cell goes dark
+		const float OctaveStep = (Hot.CutOffEndOctaves - Hot.CutOffStartOctaves) / InNumSamples;
+		float DarkOctaves = Hot.CutOffStartOctaves - FVactrolTable::CutOffRangeOctaves;
+		[[maybe_unused]] const float* ModulationValues = CutOffModulation->GetData();
+		const FCutOffTable& CutOffs = *CutOffTable;
+		const FVactrolTable& Vactrol = *VactrolTable;
+
+		//One cell lights every channel
+		auto AdvanceFrame = [&](int32 i) -> float
+		{
+			DarkOctaves += OctaveStep;
+			float Octaves = DarkOctaves;
+			if constexpr (bCutOffModulated)
+			{
+				Octaves += ModulationValues[i];
+			}
+			return UpdateVactrolCell(Vactrol, CutOffs, Octaves, InEnvelopeValues[i], Level, Coefficients);
+		};
 
-			//Finally the envelope generator value is multiplied by the clamped frequency
-			//The resulting value is used to multiply the output audio
-			//This results in the amplitude of the output audio changing
-			CalculateEnvelope();
+		int32 i = 0;
+		if constexpr (bFilterInLanes)
+		{
+			i = ProcessLowPassLanes<NumChannels, true>(States, Coefficients, InAudio, OutAudio, InNumSamples, AdvanceFrame);
+		}
 
-			//float GateEnvelope = (*OutEnvelope) * ClampedFreq;
-			float GateEnvelope = (*InEnvelope) * ClampedFreq;
+		for (; i < InNumSamples; ++i)
+		{
+			const float Gain = AdvanceFrame(i);
 
-			for (int i = 0; i < AudioInput->Num(); ++i)
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
 			{
-				OutputAudio[i] *= GateEnvelope;
+				OutAudio[Channel][i] = ProcessLowPassSample(Coefficients, States[Channel], InAudio[Channel][i]) * Gain;
 			}
 		}
+
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			States[Channel].FlushDenormals();
+			Hot.FilterStates[Channel] = States[Channel];
+		}
+		Hot.VactrolLevel = LowPassGateDSP::FlushDenormal(Level);
 	}
 
-	class FLowPassGateNode : public FNodeFacade
+	template<int32 NumChannels>
+	template<bool bCutOffModulated>
+	void TLowPassGateOperator<NumChannels>::ProcessFollowerBlock(const float* const* InAudio, float* const* OutAudio, int32 InNumSamples)
 	{
-	public:
-		FLowPassGateNode(const FNodeInitData& InInitData)
-			: FNodeFacade(InInitData.InstanceName, InInitData.InstanceID, TFacadeOperatorClass<FLowPassGateOperator>())
-		{}
-	};
+		using namespace LowPassGateDSP;
+
+		//Rebuilt only when the times change, one exp() each
+		const float AttackTimeSeconds = GetAttackSeconds();
+		const float DecayTimeSeconds = GetDecaySeconds();
+		if (AttackTimeSeconds != PreviousFollowerAttackTime || DecayTimeSeconds != PreviousFollowerDecayTime)
+		{
+			FollowerAttackCoefficient = 1.0f - FMath::Exp(-1.0f / FMath::Max(1.0f, AttackTimeSeconds * Hot.SampleRate));
+			FollowerReleaseCoefficient = 1.0f - FMath::Exp(-1.0f / FMath::Max(1.0f, DecayTimeSeconds * Hot.SampleRate));
+			PreviousFollowerAttackTime = AttackTimeSeconds;
+			PreviousFollowerDecayTime = DecayTimeSeconds;
+		}
+
+		FSVFCoefficients Coefficients = Hot.FilterCoefficients;
+		FSVFState States[NumChannels];
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			States[Channel] = Hot.FilterStates[Channel];
+		}
+		float Level = Hot.FollowerLevel;
+		const float AttackCoefficient = FollowerAttackCoefficient;
+		const float ReleaseCoefficient = FollowerReleaseCoefficient;
+
+		//Same cut off range as the vactrol, the detector takes the place of the cell so there is no extra lag
+		const float OctaveStep = (Hot.CutOffEndOctaves - Hot.CutOffStartOctaves) / InNumSamples;
+		float DarkOctaves = Hot.CutOffStartOctaves - FVactrolTable::CutOffRangeOctaves;
+		[[maybe_unused]] const float* ModulationValues = CutOffModulation->GetData();
+		const FCutOffTable& CutOffs = *CutOffTable;
+
+		//The detector runs in the filter's own loop, so the block is read once
+		//The loudest channel drives it, so every channel opens together
+		auto AdvanceFrame = [&](int32 i) -> float
+		{
+			float Input = FMath::Abs(InAudio[0][i]);
+			for (int32 Channel = 1; Channel < NumChannels; ++Channel)
+			{
+				Input = FMath::Max(Input, FMath::Abs(InAudio[Channel][i]));
+			}
+			Level += (Input - Level) * (Input > Level ? AttackCoefficient : ReleaseCoefficient);
+			const float Drive = FMath::Min(Level, 1.0f);
+
+			DarkOctaves += OctaveStep;
+			float Octaves = DarkOctaves + FVactrolTable::CutOffRangeOctaves * Drive;
+			if constexpr (bCutOffModulated)
+			{
+				Octaves += ModulationValues[i];
+			}
+			Coefficients.SetG(CutOffs.GetG(Octaves));
+
+			return FVactrolTable::GetGain(Drive);
+		};
+
+		int32 i = 0;
+		if constexpr (bFilterInLanes)
+		{
+			i = ProcessLowPassLanes<NumChannels, true>(States, Coefficients, InAudio, OutAudio, InNumSamples, AdvanceFrame);
+		}
+
+		for (; i < InNumSamples; ++i)
+		{
+			const float Gain = AdvanceFrame(i);
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				OutAudio[Channel][i] = ProcessLowPassSample(Coefficients, States[Channel], InAudio[Channel][i]) * Gain;
+			}
+		}
+
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			States[Channel].FlushDenormals();
+			Hot.FilterStates[Channel] = States[Channel];
+		}
+		Hot.FollowerLevel = FlushDenormal(Level);
+	}
+
+	template<int32 NumChannels>
+	template<ELowPassGateMode GateMode>
+	void TLowPassGateOperator<NumChannels>::ProcessOversampledBlock(const float* const* InAudio, float* const* OutAudio, int32 InNumSamples, const float* InEnvelopeValues, float InStartGain, float InEndGain)
+	{
+		static_assert(GateMode != ELowPassGateMode::VCA, "VCA mode has no filter to oversample");
+
+		using namespace LowPassGateDSP;
+
+		const int32 Factor = GetActiveOversamplingFactor();
+		const int32 TableIndex = Factor == 4 ? 1 : 0;
+		const FCutOffTable& CutOffs = *OversampledCutOffTables[TableIndex];
+		[[maybe_unused]] const FVactrolTable& Vactrol = *OversampledVactrolTables[TableIndex];
+
+		FSVFCoefficients Coefficients = Hot.FilterCoefficients;
+		FSVFState States[NumChannels];
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			States[Channel] = Hot.FilterStates[Channel];
+		}
+		[[maybe_unused]] float Level = Hot.VactrolLevel;
+
+		//Same cut off ramp and modulation as the graph rate kernels, held across the oversampled frames of each sample
+		[[maybe_unused]] const bool bUpdateCutOff = Hot.bHasCutOffModulation || Hot.bIsCutOffRamping;
+		const float OctaveStep = (Hot.CutOffEndOctaves - Hot.CutOffStartOctaves) / InNumSamples;
+		float BaseOctaves = Hot.CutOffStartOctaves;
+		const float* ModulationValues = CutOffModulation->GetData();
+
+		[[maybe_unused]] const float GainDelta = InNumSamples > 1 ? (InEndGain - InStartGain) / (InNumSamples - 1) : 0.0f;
+		[[maybe_unused]] float Gain = InStartGain;
+		//A fast envelope is what aliases, so it is interpolated rather than stepped at the oversampled rate
+		[[maybe_unused]] float PreviousDrive = Hot.PreviousEnvelopeValue;
+		[[maybe_unused]] const float InterpolationStep = 1.0f / Factor;
+
+		float Oversampled[NumChannels][FOversampler::MaxFactor];
+
+		for (int32 i = 0; i < InNumSamples; ++i)
+		{
+			BaseOctaves += OctaveStep;
+			const float Octaves = BaseOctaves + ModulationValues[i];
+
+			if constexpr (GateMode != ELowPassGateMode::Vactrol)
+			{
+				if (bUpdateCutOff)
+				{
+					Coefficients.SetG(CutOffs.GetG(Octaves));
+				}
+			}
+
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				Oversamplers[Channel].Upsample(InAudio[Channel][i], Oversampled[Channel]);
+			}
+
+			for (int32 Frame = 0; Frame < Factor; ++Frame)
+			{
+				if constexpr (GateMode == ELowPassGateMode::LowPass)
+				{
+					for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+					{
+						Oversampled[Channel][Frame] = ProcessLowPassSample(Coefficients, States[Channel], Oversampled[Channel][Frame]);
+					}
+				}
+				else
+				{
+					const float Drive = PreviousDrive + (InEnvelopeValues[i] - PreviousDrive) * (Frame + 1) * InterpolationStep;
+
+					float FrameGain;
+					if constexpr (GateMode == ELowPassGateMode::Both)
+					{
+						FrameGain = Drive * Gain;
+					}
+					else
+					{
+						FrameGain = UpdateVactrolCell(Vactrol, CutOffs, Octaves - FVactrolTable::CutOffRangeOctaves, Drive, Level, Coefficients);
+					}
+
+					for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+					{
+						Oversampled[Channel][Frame] = ProcessLowPassSample(Coefficients, States[Channel], Oversampled[Channel][Frame]) * FrameGain;
+					}
+				}
+			}
+
+			for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+			{
+				OutAudio[Channel][i] = Oversamplers[Channel].Downsample(Oversampled[Channel]);
+			}
+
+			if constexpr (GateMode != ELowPassGateMode::LowPass)
+			{
+				PreviousDrive = InEnvelopeValues[i];
+			}
+			if constexpr (GateMode == ELowPassGateMode::Both)
+			{
+				Gain += GainDelta;
+			}
+		}
+
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			States[Channel].FlushDenormals();
+			Hot.FilterStates[Channel] = States[Channel];
+		}
+
+		if constexpr (GateMode == ELowPassGateMode::Vactrol)
+		{
+			Hot.VactrolLevel = FlushDenormal(Level);
+		}
+		if constexpr (GateMode != ELowPassGateMode::LowPass)
+		{
+			Hot.PreviousEnvelopeValue = PreviousDrive;
+		}
+	}
+
+	template<int32 NumChannels>
+	bool TLowPassGateOperator<NumChannels>::IsFilterOpen() const
+	{
+		//Modulation can pull the cut off down and the oversampled path has latency to match, so neither can skip the filter
+		//A resonant peak at Nyquist is still heard, so only the unresonant filter counts as open
+		return !Hot.bHasCutOffModulation && GetActiveOversamplingFactor() == 1 && GetCutOffInput() >= 0.5f * Hot.SampleRate && *Resonance <= 0.5f;
+	}
+
+	template<int32 NumChannels>
+	void TLowPassGateOperator<NumChannels>::ApplyPassthroughFade(const float* const* InAudio, float* const* OutAudio, int32 InNumSamples, bool bInIsOpen)
+	{
+		const float Step = (bInIsOpen ? 1.0f : -1.0f) / PassthroughFadeFrames;
+		float Mix = Hot.PassthroughMix;
+
+		//Every channel fades along the same curve
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			const float* Input = InAudio[Channel];
+			float* Output = OutAudio[Channel];
+			Mix = Hot.PassthroughMix;
+
+			for (int32 i = 0; i < InNumSamples; ++i)
+			{
+				Mix = FMath::Clamp(Mix + Step, 0.0f, 1.0f);
+				Output[i] += (Input[i] - Output[i]) * Mix;
+			}
+		}
+
+		Hot.PassthroughMix = Mix;
+
+		//The filter stops running once the fade completes, start it from silence when the cut off comes back down
+		if (Hot.PassthroughMix >= 1.0f)
+		{
+			ResetFilterStates();
+		}
+	}
+
+	template<int32 NumChannels>
+	float TLowPassGateOperator<NumChannels>::GetInputPeak() const
+	{
+		float Peak = 0.0f;
+		for (const FAudioBufferReadRef& AudioInput : AudioInputs)
+		{
+			Peak = FMath::Max(Peak, LowPassGateDSP::GetPeak(AudioInput->GetData(), AudioInput->Num()));
+		}
+		return Peak;
+	}
+
+	template<int32 NumChannels>
+	void TLowPassGateOperator<NumChannels>::ZeroOutputs()
+	{
+		for (FAudioBufferWriteRef& AudioOutput : AudioOutputs)
+		{
+			AudioOutput->Zero();
+		}
+	}
+
+	template<int32 NumChannels>
+	void TLowPassGateOperator<NumChannels>::ResetFilterStates()
+	{
+		for (LowPassGateDSP::FSVFState& FilterState : Hot.FilterStates)
+		{
+			FilterState.Reset();
+		}
+	}
+
+	template<int32 NumChannels>
+	bool TLowPassGateOperator<NumChannels>::IsFilterSilent() const
+	{
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			if (!Hot.FilterStates[Channel].IsSilent() || !Oversamplers[Channel].IsSilent())
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template<int32 NumChannels>
+	void TLowPassGateOperator<NumChannels>::ResetOversamplers()
+	{
+		for (LowPassGateDSP::FOversampler& Oversampler : Oversamplers)
+		{
+			Oversampler.Reset();
+		}
+	}
+
+	template<int32 NumChannels>
+	void TLowPassGateOperator<NumChannels>::ApplyControlUpdates()
+	{
+		BlockTrigger = &(*TriggerAttackIn);
+		if (!ControlQueue.IsValid())
+		{
+			return;
+		}
+
+		//Triggers from the queue are merged with the Trigger pin into MergedTrigger, in frame order
+		QueuedTriggerFrames.Reset();
+
+		FLowPassGateUpdate Update;
+		while (ControlQueue->Dequeue(Update))
+		{
+			if (EnumHasAnyFlags(Update.Fields, ELowPassGateUpdateFields::ClearOverrides))
+			{
+				ControlCutOff = -1.0f;
+				ControlAttackTime = -1.0f;
+				ControlDecayTime = -1.0f;
+				bHasControlMode = false;
+			}
+			if (EnumHasAnyFlags(Update.Fields, ELowPassGateUpdateFields::CutOff))
+			{
+				ControlCutOff = FMath::Max(0.0f, Update.CutOff);
+			}
+			if (EnumHasAnyFlags(Update.Fields, ELowPassGateUpdateFields::Mode))
+			{
+				ControlMode = Update.Mode;
+				bHasControlMode = true;
+			}
+			if (EnumHasAnyFlags(Update.Fields, ELowPassGateUpdateFields::AttackTime))
+			{
+				ControlAttackTime = FMath::Max(0.0f, Update.AttackTime);
+			}
+			if (EnumHasAnyFlags(Update.Fields, ELowPassGateUpdateFields::DecayTime))
+			{
+				ControlDecayTime = FMath::Max(0.0f, Update.DecayTime);
+			}
+			//More than a full queue can only arrive while the game thread keeps sending during the drain, those triggers are dropped
+			if (EnumHasAnyFlags(Update.Fields, ELowPassGateUpdateFields::Trigger) && QueuedTriggerFrames.Num() < (int32)FLowPassGateControl::QueueCapacity)
+			{
+				QueuedTriggerFrames.Add(FMath::Clamp(Update.TriggerFrame, 0, Hot.NumFramesPerBlock - 1));
+			}
+		}
+
+		if (QueuedTriggerFrames.Num() == 0)
+		{
+			return;
+		}
+
+		const int32 NumPinTriggers = FMath::Min(TriggerAttackIn->NumTriggeredInBlock(), QueuedTriggerFrames.Max() - QueuedTriggerFrames.Num());
+		for (int32 TriggerIndex = 0; TriggerIndex < NumPinTriggers; ++TriggerIndex)
+		{
+			QueuedTriggerFrames.Add((*TriggerAttackIn)[TriggerIndex]);
+		}
+		QueuedTriggerFrames.Sort();
+
+		//Only ever holds this block's triggers, and a second trigger on the same frame restarts nothing
+		//so at most one per frame is kept, which is what ResetState grew the frame list to
+		MergedTrigger->Reset();
+		int32 PreviousFrame = INDEX_NONE;
+		for (int32 Frame : QueuedTriggerFrames)
+		{
+			if (Frame != PreviousFrame)
+			{
+				MergedTrigger->TriggerFrame(Frame);
+				PreviousFrame = Frame;
+			}
+		}
+		BlockTrigger = &(*MergedTrigger);
+	}
+
+	template<int32 NumChannels>
+	int32 TLowPassGateOperator<NumChannels>::UpdateCachedHits(bool bInWasEnvelopeIdle)
+	{
+		//Cut Off Mod is not part of the cache key, a modulated gate always runs live
+		const bool bUseCache = NumChannels == 1 && *ExcitationId != 0 && !Hot.bHasCutOffModulation;
+		const int32 NumTriggers = BlockTrigger->NumTriggeredInBlock();
+
+		if (!IsPlayingCachedHit() && (!bUseCache || NumTriggers == 0))
+		{
+			return 0;
+		}
+
+		//A cached hit always starts from an idle gate, a live hit that is still sounding keeps running live
+		FLowPassGateHitRef Hit;
+		if (bUseCache && NumTriggers > 0 && (CachedHit.Samples.IsValid() || bInWasEnvelopeIdle))
+		{
+			FLowPassGateHitParams Params;
+			Params.SampleRate = Hot.SampleRate;
+			Params.AttackTime = GetAttackSeconds();
+			Params.DecayTime = GetDecaySeconds();
+			Params.AttackCurve = *AttackCurveFactor;
+			Params.DecayCurve = *DecayCurveFactor;
+			Params.CutOff = GetCutOffInput();
+			Params.Resonance = *Resonance;
+			Params.Mode = Hot.ActiveMode;
+			Params.Oversampling = *Oversampling;
+			Params.ExcitationId = *ExcitationId;
+
+			Hit = FLowPassGateHitCache::Get().Find(Params);
+		}
+
+		int32 LiveStartFrame = (CachedHit.Samples.IsValid() || Hit.IsValid()) ? INDEX_NONE : 0;
+
+		for (int32 TriggerIndex = 0; TriggerIndex < NumTriggers; ++TriggerIndex)
+		{
+			const int32 Frame = (*BlockTrigger)[TriggerIndex];
+
+			//Retriggers fade the previous cached hit out rather than cutting it, any older fade is dropped
+			if (CachedHit.Samples.IsValid())
+			{
+				FadingHit = MoveTemp(CachedHit);
+				FadingHit.FadeStartFrame = Frame;
+				FadingHit.FadeGain = 1.0f;
+				CachedHit = FCachedHitVoice();
+			}
+
+			if (Hit.IsValid() && LiveStartFrame == INDEX_NONE)
+			{
+				CachedHit.Samples = Hit;
+				CachedHit.StartFrame = Frame;
+			}
+			else if (LiveStartFrame == INDEX_NONE)
+			{
+				//No match, the live gate takes over from a clean filter
+				LiveStartFrame = Frame;
+				ResetFilterStates();
+				Hot.VactrolLevel = 0.0f;
+				ResetOversamplers();
+				Hot.PreviousEnvelopeValue = 0.0f;
+			}
+		}
+
+		return LiveStartFrame;
+	}
+
+	template<int32 NumChannels>
+	void TLowPassGateOperator<NumChannels>::MixCachedHitVoice(FCachedHitVoice& InOutVoice, float* OutAudio, int32 InNumSamples)
+	{
+		if (!InOutVoice.Samples.IsValid())
+		{
+			return;
+		}
+
+		const float* Samples = InOutVoice.Samples->GetData();
+		const int32 NumHitSamples = InOutVoice.Samples->Num();
+		const int32 FadeStartFrame = InOutVoice.FadeStartFrame == INDEX_NONE ? InNumSamples : InOutVoice.FadeStartFrame;
+		const float FadeStep = 1.0f / PassthroughFadeFrames;
+
+		int32 Position = InOutVoice.Position;
+		float Gain = InOutVoice.FadeGain;
+
+		for (int32 i = InOutVoice.StartFrame; i < InNumSamples && Position < NumHitSamples && Gain > 0.0f; ++i, ++Position)
+		{
+			if (i >= FadeStartFrame)
+			{
+				Gain = FMath::Max(0.0f, Gain - FadeStep);
+			}
+			OutAudio[i] += Samples[Position] * Gain;
+		}
+
+		if (Position >= NumHitSamples || Gain <= 0.0f)
+		{
+			//The cache keeps every hit it handed out until it holds the last reference, so this never frees on the render thread
+			InOutVoice = FCachedHitVoice();
+			return;
+		}
+
+		InOutVoice.Position = Position;
+		InOutVoice.FadeGain = Gain;
+		InOutVoice.StartFrame = 0;
+		if (InOutVoice.FadeStartFrame != INDEX_NONE)
+		{
+			InOutVoice.FadeStartFrame = 0;
+		}
+	}
+
+	template<int32 NumChannels>
+	void TLowPassGateOperator<NumChannels>::FinishCachedHits(float* OutAudio, int32 InNumSamples, int32 InLiveStartFrame)
+	{
+		//Whatever the live gate rendered before it took over belongs to the cached hit it replaced
+		if (InLiveStartFrame > 0)
+		{
+			FMemory::Memzero(OutAudio, sizeof(float) * InLiveStartFrame);
+		}
+
+		MixCachedHitVoice(CachedHit, OutAudio, InNumSamples);
+		MixCachedHitVoice(FadingHit, OutAudio, InNumSamples);
+	}
+
+	template<int32 NumChannels>
+	bool TLowPassGateOperator<NumChannels>::IsGateIdle() const
+	{
+		if (Hot.EnvelopeState.CurrentSampleIndex != INDEX_NONE || CachedHit.Samples.IsValid())
+		{
+			return false;
+		}
+		return Hot.ActiveMode != ELowPassGateMode::Vactrol || LowPassGateDSP::FVactrolTable::GetGain(Hot.VactrolLevel) < LowPassGateDSP::SilenceThreshold;
+	}
+
+	template<int32 NumChannels>
+	void TLowPassGateOperator<NumChannels>::UpdateOversampling()
+	{
+		//The follower's detector and filter always run at the graph rate, and so does every gate once the budget drops oversampling
+		const bool bAtGraphRate = Hot.ActiveMode == ELowPassGateMode::Follower || GetDegradation() >= ELowPassGateDegradation::NoOversampling;
+		const int32 Factor = bAtGraphRate ? 1 : GetOversamplingFactor(*Oversampling);
+		if (Factor == GetActiveOversamplingFactor())
+		{
+			return;
+		}
+
+		for (LowPassGateDSP::FOversampler& Oversampler : Oversamplers)
+		{
+			Oversampler.SetFactor(Factor);
+		}
+		Hot.PreviousEnvelopeValue = Hot.EnvelopeState.CurrentEnvelopeValue;
+
+		//The coefficients depend on the rate the filter runs at, so they are rebuilt next block without a glide
+		Hot.PreviousFrequency = -1.0f;
+	}
+
+	template<int32 NumChannels>
+	void TLowPassGateOperator<NumChannels>::Execute()
+	{
+		//The mono and multichannel gates are timed separately, the work is the same
+		if constexpr (NumChannels == 1)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(BuchlaBongo::LPGExecute);
+			SCOPE_CYCLE_COUNTER(STAT_BuchlaBongo_LPGExecute);
+			CSV_SCOPED_TIMING_STAT(BuchlaBongo, LPGExecute);
+			ExecuteBlock();
+		}
+		else
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(BuchlaBongo::LPGMultichannelExecute);
+			SCOPE_CYCLE_COUNTER(STAT_BuchlaBongo_LPGMultichannelExecute);
+			CSV_SCOPED_TIMING_STAT(BuchlaBongo, LPGMultichannelExecute);
+			ExecuteBlock();
+		}
+	}
+
+	template<int32 NumChannels>
+	void TLowPassGateOperator<NumChannels>::ExecuteBlock()
+	{
+#if BUCHLABONGO_RENDER_ALLOCATION_CHECKS
+		//Only counts while allocation tracking is installed, see BuchlaBongoAllocations.h
+		BuchlaBongoAllocations::FRenderScope AllocationScope(TEXT("Buchla Low Pass Gate"));
+#endif
+
+		const uint64 StartCycles = BudgetVoice.BeginBlock();
+		ON_SCOPE_EXIT
+		{
+			BudgetVoice.EndBlock(StartCycles, Hot.SampleRate, Hot.NumFramesPerBlock);
+		};
+
+		ApplyControlUpdates();
+
+		//The kernel is only re-selected when the mode input changes, not branched on every block
+		const bool bModeChanged = GetModeInput() != Hot.ActiveMode;
+		if (bModeChanged)
+		{
+			SelectExecuteMode(GetModeInput());
+		}
+
+		UpdateOversampling();
+
+		if (Hot.bIsSleeping)
+		{
+			if (!ShouldWake(bModeChanged))
+			{
+				ExecuteSleeping();
+				return;
+			}
+			SetSleeping(false);
+			//Treated as full scale on waking, so the attack of a new hit is never taken for a quiet gate
+			Hot.bIsCulled = false;
+			BudgetVoice.ResetPeak();
+		}
+
+		(this->*ExecuteModeFunction)();
+
+		if (BudgetVoice.IsMeasuring())
+		{
+			float OutputPeak = 0.0f;
+			for (const FAudioBufferWriteRef& AudioOutput : AudioOutputs)
+			{
+				OutputPeak = FMath::Max(OutputPeak, LowPassGateDSP::GetPeak(AudioOutput->GetData(), AudioOutput->Num()));
+			}
+			if (BudgetVoice.ShouldCull(OutputPeak))
+			{
+				FastRelease();
+			}
+		}
+
+		if (CanSleep())
+		{
+			//Whatever is left in the filter is inaudible, and a sleeping gate runs no filter at all in any mode
+			//so every mode starts from a clean state on wake up rather than from one as old as the sleep
+			SetSleeping(true);
+			Hot.bIsOutputCleared = false;
+			if (!Hot.bIsCulled)
+			{
+				BudgetVoice.LeaveRanking();
+			}
+			ResetFilterStates();
+			ResetOversamplers();
+			Hot.VactrolLevel = 0.0f;
+			Hot.FollowerLevel = 0.0f;
+			*OutEnvelope = 0.0f;
+			Hot.PreviousEnvelopeValue = 0.0f;
+		}
+	}
+
+	template<int32 NumChannels>
+	void TLowPassGateOperator<NumChannels>::SetSleeping(bool bInIsSleeping)
+	{
+		if (bInIsSleeping == Hot.bIsSleeping)
+		{
+			return;
+		}
+
+		if (bInIsSleeping)
+		{
+			DEC_DWORD_STAT(STAT_BuchlaBongo_ActiveGates);
+			INC_DWORD_STAT(STAT_BuchlaBongo_SleepingGates);
+		}
+		else
+		{
+			DEC_DWORD_STAT(STAT_BuchlaBongo_SleepingGates);
+			INC_DWORD_STAT(STAT_BuchlaBongo_ActiveGates);
+		}
+
+		Hot.bIsSleeping = bInIsSleeping;
+	}
+
+	template<int32 NumChannels>
+	void TLowPassGateOperator<NumChannels>::FastRelease()
+	{
+		//One block is about 5ms at 48kHz, short enough to shed the gate quickly and long enough not to click
+		for (FAudioBufferWriteRef& AudioOutput : AudioOutputs)
+		{
+			Audio::ArrayFade(MakeArrayView(AudioOutput->GetData(), AudioOutput->Num()), 1.0f, 0.0f);
+		}
+
+		//Anything waiting on the envelope still hears it finish
+		if (UsesEnvelope(Hot.ActiveMode) && Hot.EnvelopeState.CurrentSampleIndex != INDEX_NONE)
+		{
+			OnDone->TriggerFrame(Hot.NumFramesPerBlock - 1);
+		}
+		Hot.EnvelopeState.CurrentSampleIndex = INDEX_NONE;
+		Hot.EnvelopeState.CurrentEnvelopeValue = 0.0f;
+		CachedHit = FCachedHitVoice();
+		FadingHit = FCachedHitVoice();
+		Hot.bIsCulled = true;
+
+		INC_DWORD_STAT(STAT_BuchlaBongo_CulledGates);
+	}
+
+	template<int32 NumChannels>
+	bool TLowPassGateOperator<NumChannels>::CanSleep() const
+	{
+		if (Hot.bIsCulled)
+		{
+			return true;
+		}
+
+		if (Hot.ActiveMode == ELowPassGateMode::LowPass)
+		{
+			return IsFilterSilent() && GetInputPeak() < LowPassGateDSP::SilenceThreshold;
+		}
+
+		if (Hot.ActiveMode == ELowPassGateMode::Follower)
+		{
+			return Hot.FollowerLevel < LowPassGateDSP::SilenceThreshold && IsFilterSilent() && GetInputPeak() < LowPassGateDSP::SilenceThreshold;
+		}
+
+		if (IsPlayingCachedHit())
+		{
+			return false;
+		}
+
+		//The gate is closed once the envelope is done, whatever is on the input
+		const bool bIsEnvelopeIdle = Hot.EnvelopeState.CurrentSampleIndex == INDEX_NONE;
+		if (Hot.ActiveMode == ELowPassGateMode::Vactrol)
+		{
+			return bIsEnvelopeIdle && LowPassGateDSP::FVactrolTable::GetGain(Hot.VactrolLevel) < LowPassGateDSP::SilenceThreshold;
+		}
+
+		return bIsEnvelopeIdle;
+	}
+
+	template<int32 NumChannels>
+	bool TLowPassGateOperator<NumChannels>::ShouldWake(bool bInModeChanged) const
+	{
+		//The new kernel has already been selected, it gets at least one block to decide whether it is idle
+		if (bInModeChanged)
+		{
+			return true;
+		}
+
+		if (!UsesEnvelope(Hot.ActiveMode))
+		{
+			//A culled gate has nothing to wake it but its input, which has to rank above the voices being culled
+			const float InputPeak = GetInputPeak();
+			return InputPeak >= LowPassGateDSP::SilenceThreshold && (!Hot.bIsCulled || BudgetVoice.IsAboveCull(InputPeak));
+		}
+
+		return (Hot.bHasTriggerInput || ControlQueue.IsValid()) && BlockTrigger->IsTriggeredInBlock();
+	}
+
+	template<int32 NumChannels>
+	void TLowPassGateOperator<NumChannels>::ExecuteSleeping()
+	{
+		if (UsesEnvelope(Hot.ActiveMode))
+		{
+			OnAttackTrigger->AdvanceBlock();
+			OnDone->AdvanceBlock();
+		}
+
+		//Nothing else writes to the output buffer, so once it has been zeroed it can be left alone
+		if (!Hot.bIsOutputCleared)
+		{
+			ZeroOutputs();
+			Hot.bIsOutputCleared = true;
+		}
+	}
+
+	template<int32 NumChannels>
+	void TLowPassGateOperator<NumChannels>::SelectExecuteMode(ELowPassGateMode InMode)
+	{
+		//LowPass and Follower do not run the envelope, so clear any triggers left over from the previous mode
+		if (!UsesEnvelope(InMode) && UsesEnvelope(Hot.ActiveMode))
+		{
+			OnAttackTrigger->AdvanceBlock();
+			OnDone->AdvanceBlock();
+		}
+
+		Hot.ActiveMode = InMode;
+		Hot.PassthroughMix = 0.0f;
+		CachedHit = FCachedHitVoice();
+		FadingHit = FCachedHitVoice();
+
+		switch (InMode)
+		{
+		case ELowPassGateMode::VCA:
+			ExecuteModeFunction = &TLowPassGateOperator::ExecuteMode<ELowPassGateMode::VCA>;
+			break;
+
+		case ELowPassGateMode::Both:
+			ExecuteModeFunction = &TLowPassGateOperator::ExecuteMode<ELowPassGateMode::Both>;
+			break;
+
+		case ELowPassGateMode::Vactrol:
+			ExecuteModeFunction = &TLowPassGateOperator::ExecuteMode<ELowPassGateMode::Vactrol>;
+			break;
+
+		case ELowPassGateMode::Follower:
+			ExecuteModeFunction = &TLowPassGateOperator::ExecuteMode<ELowPassGateMode::Follower>;
+			break;
+
+		case ELowPassGateMode::LowPass:
+		default:
+			ExecuteModeFunction = &TLowPassGateOperator::ExecuteMode<ELowPassGateMode::LowPass>;
+			break;
+		}
+	}
+
+	template<int32 NumChannels>
+	template<ELowPassGateMode GateMode>
+	void TLowPassGateOperator<NumChannels>::ExecuteMode()
+	{
+		const float* Inputs[NumChannels];
+		float* Outputs[NumChannels];
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			Inputs[Channel] = AudioInputs[Channel]->GetData();
+			Outputs[Channel] = AudioOutputs[Channel]->GetData();
+		}
+		const int32 NumSamples = AudioInputs[0]->Num();
+
+		if constexpr (GateMode == ELowPassGateMode::Follower)
+		{
+			//No envelope and no cached hits, the input is its own trigger
+			HandleLowPassFilter();
+
+			if (Hot.bHasCutOffModulation)
+			{
+				ProcessFollowerBlock<true>(Inputs, Outputs, NumSamples);
+			}
+			else
+			{
+				ProcessFollowerBlock<false>(Inputs, Outputs, NumSamples);
+			}
+			*OutEnvelope = Hot.FollowerLevel;
+		}
+		else if constexpr (GateMode == ELowPassGateMode::LowPass)
+		{
+			//Passes the input audio through the state variable low pass filter
+			HandleLowPassFilter();
+
+			const bool bIsOpen = IsFilterOpen();
+			if (bIsOpen && Hot.PassthroughMix >= 1.0f)
+			{
+				for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+				{
+					FMemory::Memcpy(Outputs[Channel], Inputs[Channel], sizeof(float) * NumSamples);
+				}
+				return;
+			}
+
+			if (GetActiveOversamplingFactor() > 1)
+			{
+				ProcessOversampledBlock<ELowPassGateMode::LowPass>(Inputs, Outputs, NumSamples);
+			}
+			else
+			{
+				ProcessFilter<false>(Inputs, Outputs, NumSamples);
+			}
+
+			if (bIsOpen || Hot.PassthroughMix > 0.0f)
+			{
+				ApplyPassthroughFade(Inputs, Outputs, NumSamples, bIsOpen);
+			}
+		}
+		else
+		{
+			//Checked before the envelope runs, a cached hit can only take over from silence
+			const bool bWasIdle = IsGateIdle();
+
+			if constexpr (GateMode == ELowPassGateMode::VCA)
+			{
+				//VCA mode never touches the filter
+				//The mono gate generates the per-sample envelope straight into its output and multiplies the input into it
+				float* EnvelopeValues = NumChannels == 1 ? Outputs[0] : EnvelopeBuffer.GetData();
+				const bool bIsEnvelopeActive = CalculateEnvelope(EnvelopeValues);
+				const int32 LiveStartFrame = UpdateCachedHits(bWasIdle);
+
+				if (LiveStartFrame == INDEX_NONE)
+				{
+					ZeroOutputs();
+				}
+				else if (bIsEnvelopeActive)
+				{
+					if constexpr (NumChannels == 1)
+					{
+						Audio::ArrayMultiplyInPlace(MakeArrayView(Inputs[0], NumSamples), MakeArrayView(Outputs[0], NumSamples));
+					}
+					else
+					{
+						const TArrayView<const float> EnvelopeView(EnvelopeValues, NumSamples);
+						for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+						{
+							Audio::ArrayMultiply(MakeArrayView(Inputs[Channel], NumSamples), EnvelopeView, MakeArrayView(Outputs[Channel], NumSamples));
+						}
+					}
+				}
+				else if constexpr (NumChannels > 1)
+				{
+					//The idle envelope only zeroed the scratch buffer
+					ZeroOutputs();
+				}
+				FinishCachedHits(Outputs[0], NumSamples, LiveStartFrame);
+			}
+			else if constexpr (GateMode == ELowPassGateMode::Both)
+			{
+				//This code follows the pure Metasound Node prototype of the Buchla Bongo
+				//The Cut Off Frequency is clamped between a value of 0-1
+				TRange<float> InRange = TRange<float>(0.0f, 1500.0f);
+				TRange<float> OutRange = TRange<float>(0.0f, 1.0f);
+				float ClampedFreq = FMath::GetMappedRangeValueClamped(InRange, OutRange, GetCutOffInput());
+
+				HandleLowPassFilter();
+
+				float* EnvelopeValues = EnvelopeBuffer.GetData();
+				const bool bIsEnvelopeActive = CalculateEnvelope(EnvelopeValues);
+				const int32 LiveStartFrame = UpdateCachedHits(bWasIdle);
+
+				if (LiveStartFrame == INDEX_NONE)
+				{
+					ZeroOutputs();
+				}
+				else if (bIsEnvelopeActive)
+				{
+					//The audio is passed through the low pass filter first to avoid any adverse interactions
+					//between the Envelope Generator and the filter, then multiplied by the envelope and the clamped frequency
+					//Both happen in the same loop so the block is only read and written once
+					//Cut off changes are ramped across the block rather than stepping the gain
+					//The very first block starts at the target gain, so the output does not depend on the block size
+					const float StartGain = Hot.PreviousGateGain < 0.0f ? ClampedFreq : Hot.PreviousGateGain;
+					if (GetActiveOversamplingFactor() > 1)
+					{
+						ProcessOversampledBlock<ELowPassGateMode::Both>(Inputs, Outputs, NumSamples, EnvelopeValues, StartGain, ClampedFreq);
+					}
+					else
+					{
+						ProcessFilter<true>(Inputs, Outputs, NumSamples, EnvelopeValues, StartGain, ClampedFreq);
+					}
+				}
+				else
+				{
+					//The gate is closed, keep the filter running so it is in the right state for the next hit
+					if (GetActiveOversamplingFactor() > 1)
+					{
+						ProcessOversampledBlock<ELowPassGateMode::LowPass>(Inputs, Outputs, NumSamples);
+						Hot.PreviousEnvelopeValue = 0.0f;
+					}
+					else
+					{
+						ProcessFilter<false>(Inputs, Outputs, NumSamples);
+					}
+					ZeroOutputs();
+				}
+				Hot.PreviousGateGain = ClampedFreq;
+				FinishCachedHits(Outputs[0], NumSamples, LiveStartFrame);
+			}
+			else if constexpr (GateMode == ELowPassGateMode::Vactrol)
+			{
+				HandleLowPassFilter();
+
+				//Even once the envelope is idle the cell keeps glowing, so the tail is always rendered
+				float* EnvelopeValues = EnvelopeBuffer.GetData();
+				CalculateEnvelope(EnvelopeValues);
+				const int32 LiveStartFrame = UpdateCachedHits(bWasIdle);
+
+				if (LiveStartFrame == INDEX_NONE)
+				{
+					ZeroOutputs();
+				}
+				else if (GetActiveOversamplingFactor() > 1)
+				{
+					ProcessOversampledBlock<ELowPassGateMode::Vactrol>(Inputs, Outputs, NumSamples, EnvelopeValues);
+				}
+				else if (Hot.bHasCutOffModulation)
+				{
+					ProcessVactrolBlock<true>(Inputs, Outputs, NumSamples, EnvelopeValues);
+				}
+				else
+				{
+					ProcessVactrolBlock<false>(Inputs, Outputs, NumSamples, EnvelopeValues);
+				}
+				FinishCachedHits(Outputs[0], NumSamples, LiveStartFrame);
+			}
+		}
+	}
+
+	template class TLowPassGateOperator<1>;
+	template class TLowPassGateOperator<2>;
+	template class TLowPassGateOperator<4>;
+	template class TLowPassGateOperator<6>;
+	template class TLowPassGateOperator<8>;
+
+	template<int32 NumChannels>
+	class TLowPassGateNode : public FNodeFacade
+	{
+	public:
+		TLowPassGateNode(const FNodeInitData& InInitData)
+			: FNodeFacade(InInitData.InstanceName, InInitData.InstanceID, TFacadeOperatorClass<TLowPassGateOperator<NumChannels>>())
+		{}
+	};
+
+	using FLowPassGateNode = TLowPassGateNode<1>;
+	using FLowPassGateStereoNode = TLowPassGateNode<2>;
+	using FLowPassGateQuadNode = TLowPassGateNode<4>;
+	using FLowPassGate5Point1Node = TLowPassGateNode<6>;
+	using FLowPassGate7Point1Node = TLowPassGateNode<8>;
 
 	METASOUND_REGISTER_NODE(FLowPassGateNode);
+	METASOUND_REGISTER_NODE(FLowPassGateStereoNode);
+	METASOUND_REGISTER_NODE(FLowPassGateQuadNode);
+	METASOUND_REGISTER_NODE(FLowPassGate5Point1Node);
+	METASOUND_REGISTER_NODE(FLowPassGate7Point1Node);
 }
 
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
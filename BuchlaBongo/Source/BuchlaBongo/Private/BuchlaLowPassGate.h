@@ -0,0 +1,277 @@
+#pragma once
+
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundNodeInterface.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundTrigger.h"
+#include "MetasoundTime.h"
+#include "MetasoundAudioBuffer.h"
+#include "BuchlaLowPassGateTypes.h"
+#include "BuchlaEnvelope.h"
+#include "BuchlaLowPassGateDSP.h"
+#include "BuchlaLowPassGateBudget.h"
+#include "BuchlaBongoAllocations.h"
+#include "Misc/EngineVersionComparison.h"
+
+namespace Metasound
+{
+	//The gate for NumChannels channels, every channel shares the envelope, the filter coefficients and the gain
+	//The mono gate is TLowPassGateOperator<1>, the multichannel nodes only add audio pins and drop the mono-only Excitation ID
+	//Declared here so the benchmark and regression tools can drive the operator directly
+	template<int32 NumChannels>
+	class TLowPassGateOperator : public TExecutableOperator<TLowPassGateOperator<NumChannels>>
+	{
+		static_assert(NumChannels >= 1, "The gate needs at least one channel");
+
+	public:
+		static const FNodeClassMetadata& GetNodeInfo();
+		static const FVertexInterface& GetVertexInterface();
+		static TUniquePtr<IOperator> CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors);
+
+		//Mono pins are named "In" and "Out", every other channel count numbers them from "In 0"
+		static FVertexName GetInputAudioName(int32 InChannel);
+		static FVertexName GetOutputAudioName(int32 InChannel);
+
+		//InAudioInputs holds NumChannels inputs, InExcitationId and InDeprecatedEnvelope are only pins on the mono gate
+		TLowPassGateOperator(const FOperatorSettings& InSettings,
+			const FTriggerReadRef& InTriggerIn,
+			const FTimeReadRef& InAttackTime,
+			const FTimeReadRef& InDecayTime,
+			const FFloatReadRef& InAttackCurveFactor,
+			const FFloatReadRef& InDecayCurveFactor,
+			const TArray<FAudioBufferReadRef>& InAudioInputs,
+			const FFloatReadRef& InCutOff,
+			const FFloatReadRef& InResonance,
+			const FEnumLowPassGateModeReadRef& InGateMode,
+			const FAudioBufferReadRef& InCutOffModulation,
+			const FEnumLowPassGateOversamplingReadRef& InOversampling,
+			const FInt32ReadRef& InExcitationId,
+			const FInt32ReadRef& InGateId,
+			const FFloatReadRef& InDeprecatedEnvelope,
+			bool bInHasCutOffModulation,
+			bool bInHasTriggerInput);
+		virtual ~TLowPassGateOperator();
+
+		virtual FDataReferenceCollection GetInputs() const override;
+		virtual FDataReferenceCollection GetOutputs() const override;
+
+		void UpdateParams();
+		void Execute();
+
+		//Readies the operator for reuse at InSettings, the outputs keep their identity so existing bindings stay valid
+		//Scratch and output buffers are resized in place when the block size changes
+		void Reset(const FOperatorSettings& InSettings);
+#if !UE_VERSION_OLDER_THAN(5, 3, 0)
+		//Lets the engine pool and reuse the operator instead of rebuilding it for every new source
+		void Reset(const IOperator::FResetParams& InParams) { Reset(InParams.OperatorSettings); }
+#endif
+		//Puts the operator back into the state it was constructed in, shared by the constructor and Reset()
+		void ResetState(const FOperatorSettings& InSettings);
+		void FetchOversampledTables(float InSampleRate);
+
+		void HandleLowPassFilter();
+
+		//The kernels take one buffer per channel, anything shared by the channels is worked out once per sample
+		//Stereo, quad and 7.1 run the graph rate filters four channels to a register, see TSVFStateLanes
+		//5.1 would leave half of its second register idle, and six independent scalar filters already keep the pipeline as busy
+		static constexpr bool bFilterInLanes = NumChannels == 2 || NumChannels % 4 == 0;
+		//Runs the low pass filter over the block, optionally applying the envelope and a gain ramp in the same loop
+		template<bool bCutOffModulated, bool bApplyGate>
+		void ProcessFilterBlock(const float* const* InAudio, float* const* OutAudio, int32 InNumSamples, const float* InEnvelopeValues, float InStartGain, float InEndGain);
+
+		template<bool bApplyGate>
+		void ProcessFilter(const float* const* InAudio, float* const* OutAudio, int32 InNumSamples, const float* InEnvelopeValues = nullptr, float InStartGain = 1.0f, float InEndGain = 1.0f);
+
+		//The envelope drives the vactrol cell, whose level then sets both the filter cut off and the gain per sample
+		template<bool bCutOffModulated>
+		void ProcessVactrolBlock(const float* const* InAudio, float* const* OutAudio, int32 InNumSamples, const float* InEnvelopeValues);
+		//The input's own level opens the gate, a peak detector with the Attack and Decay times drives cut off and gain like a lit vactrol
+		template<bool bCutOffModulated>
+		void ProcessFollowerBlock(const float* const* InAudio, float* const* OutAudio, int32 InNumSamples);
+		//Filter and gate at the Oversampling rate, with the envelope interpolated between graph rate samples
+		//LowPass ignores the envelope and gain arguments, VCA never filters and has no oversampled kernel
+		template<ELowPassGateMode GateMode>
+		void ProcessOversampledBlock(const float* const* InAudio, float* const* OutAudio, int32 InNumSamples, const float* InEnvelopeValues = nullptr, float InStartGain = 1.0f, float InEndGain = 1.0f);
+		//Applies a change of the Oversampling input, the filter coefficients are recomputed for the new rate
+		void UpdateOversampling();
+		//LowPass with the cut off at Nyquist lets everything through, so the input is copied instead of filtered
+		bool IsFilterOpen() const;
+		//Crossfades OutAudio towards or away from InAudio, OutAudio must already hold the filtered block
+		void ApplyPassthroughFade(const float* const* InAudio, float* const* OutAudio, int32 InNumSamples, bool bInIsOpen);
+		//Loudest sample on any input channel this block
+		float GetInputPeak() const;
+		void ZeroOutputs();
+		void ResetFilterStates();
+		//Every channel's filter and oversampler history has died away
+		bool IsFilterSilent() const;
+		void ResetOversamplers();
+		int32 GetActiveOversamplingFactor() const { return Oversamplers[0].GetFactor(); }
+		//Starts and stops playback of pre-rendered hits on this block's triggers, only the mono gate has an Excitation ID
+		//Returns the first frame the live gate is heard from, or INDEX_NONE when the whole block is played back from the cache
+		int32 UpdateCachedHits(bool bInWasEnvelopeIdle);
+		//Silences the live output before InLiveStartFrame and adds whatever cached hits are playing into OutAudio
+		void FinishCachedHits(float* OutAudio, int32 InNumSamples, int32 InLiveStartFrame);
+		//No live or cached hit is sounding, so a cached hit can start without cutting anything off
+		bool IsGateIdle() const;
+		//Bytes this instance owns, the shared cut off and vactrol tables are not included
+		SIZE_T GetAllocatedSize() const;
+		static constexpr SIZE_T GetHotStateSize() { return sizeof(FHotState); }
+		bool IsPlayingCachedHit() const { return CachedHit.Samples.IsValid() || FadingHit.Samples.IsValid(); }
+		//Drains the Gate ID queue, and picks the trigger the rest of the block reads from
+		void ApplyControlUpdates();
+		//Pin values, unless gameplay code has sent its own through the Gate ID queue
+		float GetCutOffInput() const { return ControlCutOff >= 0.0f ? ControlCutOff : *CutOffFrequency; }
+		float GetAttackSeconds() const { return ControlAttackTime >= 0.0f ? ControlAttackTime : (float)AttackTime->GetSeconds(); }
+		float GetDecaySeconds() const { return ControlDecayTime >= 0.0f ? ControlDecayTime : (float)DecayTime->GetSeconds(); }
+		ELowPassGateMode GetModeInput() const { return bHasControlMode ? ControlMode : *Mode; }
+		//Writes the per-sample envelope for this block to OutEnvelopeValues, returns false if it stayed idle for the whole block
+		bool CalculateEnvelope(float* OutEnvelopeValues);
+
+		//Per-mode kernels, each specialization only does the work its mode needs
+		//Execute() only picks the stat the block is counted under, ExecuteBlock() does the work
+		template<ELowPassGateMode GateMode>
+		void ExecuteMode();
+		void SelectExecuteMode(ELowPassGateMode InMode);
+		void ExecuteBlock();
+
+		//Idle gates sleep until the next trigger, or until non-silent input arrives in LowPass mode
+		bool CanSleep() const;
+		//bInModeChanged is whether the mode input changed this block, Execute() has already switched kernels by the time this is asked
+		bool ShouldWake(bool bInModeChanged) const;
+		//Keeps the active and sleeping stat counters in step with bIsSleeping
+		void SetSleeping(bool bInIsSleeping);
+		void ExecuteSleeping();
+
+		//Smoothed seconds Execute() takes per block, this is what the gate reports to FLowPassGateBudget
+		float GetEstimatedBlockCost() const { return BudgetVoice.GetEstimatedBlockCost(); }
+		//Takes the gate in or out of FLowPassGateBudget, see FLowPassGateBudgetVoice::SetEnabled
+		void SetUsesCpuBudget(bool bInUsesCpuBudget) { BudgetVoice.SetEnabled(bInUsesCpuBudget); }
+		ELowPassGateDegradation GetDegradation() const { return BudgetVoice.GetDegradation(); }
+		//Fades the block just rendered to silence and leaves the gate idle, so it goes to sleep at the end of the block
+		void FastRelease();
+
+	private:
+		FTriggerReadRef TriggerAttackIn;
+		FTimeReadRef AttackTime;
+		FTimeReadRef DecayTime;
+		FFloatReadRef AttackCurveFactor;
+		FFloatReadRef DecayCurveFactor;
+		TArray<FAudioBufferReadRef, TFixedAllocator<NumChannels>> AudioInputs;
+		FFloatReadRef CutOffFrequency;
+		FFloatReadRef Resonance;
+		FEnumLowPassGateModeReadRef Mode;
+		FAudioBufferReadRef CutOffModulation;
+		FEnumLowPassGateOversamplingReadRef Oversampling;
+		FInt32ReadRef ExcitationId;
+		FInt32ReadRef GateId;
+		//Never read, only held so the old Envelope pin keeps its connection
+		FFloatReadRef DeprecatedEnvelope;
+
+		FTriggerWriteRef OnAttackTrigger;
+		FTriggerWriteRef OnDone;
+		TDataWriteReference<float> OutEnvelope;
+		TArray<FAudioBufferWriteRef, TFixedAllocator<NumChannels>> AudioOutputs;
+
+		//The Trigger pin, or MergedTrigger in blocks where queued triggers arrived
+		const FTrigger* BlockTrigger = nullptr;
+		FTriggerWriteRef MergedTrigger;
+		//Scratch for merging the queued triggers, reserved in ResetState so a busy queue never allocates on the render thread
+		TArray<int32> QueuedTriggerFrames;
+		//Registered for the Gate ID the gate was constructed with and kept until destruction, Reset() does not re-read the pin
+		FLowPassGateUpdateQueuePtr ControlQueue;
+		int32 ControlGateId = 0;
+		//Negative until an update for that parameter arrives
+		float ControlCutOff = -1.0f;
+		float ControlAttackTime = -1.0f;
+		float ControlDecayTime = -1.0f;
+		ELowPassGateMode ControlMode = ELowPassGateMode::LowPass;
+		bool bHasControlMode = false;
+
+		//Everything Execute() reads or writes on every block, packed into one aligned block so it spans the fewest cache lines
+		//Each channel past the first adds one filter state
+		//The leading fields are all a sleeping gate touches
+		struct alignas(PLATFORM_CACHE_LINE_SIZE) FHotState
+		{
+			ELowPassGateMode ActiveMode = ELowPassGateMode::LowPass;
+			bool bIsSleeping = false;
+			bool bIsOutputCleared = false;
+			//Without a connected Trigger the envelope can never start, so the envelope modes never leave sleep
+			bool bHasTriggerInput = true;
+			//Only true when the Cut Off Mod pin is connected, otherwise the filter stays block-rate
+			bool bHasCutOffModulation = false;
+			bool bIsCutOffRamping = false;
+			//Released by the CPU budget, kept asleep until a trigger or an input that ranks above the voices being culled
+			bool bIsCulled = false;
+			float SampleRate = 0.0f;
+			int32 NumFramesPerBlock = 0;
+
+			LowPassGateDSP::FSVFCoefficients FilterCoefficients;
+			LowPassGateDSP::FSVFState FilterStates[NumChannels];
+			float VactrolLevel = 0.0f;
+			//0 when the filter is heard, 1 when the input is copied straight to the output
+			float PassthroughMix = 0.0f;
+			//Last envelope value of the previous block, the start point for interpolating the envelope at the oversampled rate
+			float PreviousEnvelopeValue = 0.0f;
+			float PreviousFrequency = -1.0f;
+			float PreviousResonance = -1.0f;
+			float PreviousGateGain = -1.0f;
+			//Cut off in FCutOffTable octaves at the start and end of the block, equal unless the cut off just changed
+			float CutOffStartOctaves = 0.0f;
+			float CutOffEndOctaves = 0.0f;
+			//Follower mode detector output, 1 is a full scale input
+			float FollowerLevel = 0.0f;
+
+			FEnvelopeState EnvelopeState;
+		};
+		static_assert(NumChannels > 1 || sizeof(FHotState) <= 128, "The per-block state of the mono gate should stay within two 64 byte cache lines");
+		FHotState Hot;
+
+		using FExecuteModeFunction = void (TLowPassGateOperator::*)();
+		FExecuteModeFunction ExecuteModeFunction = nullptr;
+
+		//Cold state from here on, only read when a parameter changes or a hit starts
+		//Per-sample envelope for the current block, the Envelope output pin reports its last value
+		FAudioBuffer EnvelopeBuffer;
+		//Reused by every envelope range so the trigger callbacks never allocate on the render thread
+		TArray<int32> FinishedFrames;
+		TSharedRef<const LowPassGateDSP::FCutOffTable> CutOffTable;
+		TSharedRef<const LowPassGateDSP::FVactrolTable> VactrolTable;
+		//One per channel, they all run at the same factor
+		LowPassGateDSP::FOversampler Oversamplers[NumChannels];
+		//Tables for the 2x and 4x filter rates, fetched up front so changing Oversampling never builds one on the render thread
+		TSharedPtr<const LowPassGateDSP::FCutOffTable> OversampledCutOffTables[2];
+		TSharedPtr<const LowPassGateDSP::FVactrolTable> OversampledVactrolTables[2];
+		struct FCachedHitVoice
+		{
+			FLowPassGateHitRef Samples;
+			int32 Position = 0;
+			//Frames of the current block the voice starts playing and starts fading out from
+			int32 StartFrame = 0;
+			int32 FadeStartFrame = INDEX_NONE;
+			float FadeGain = 1.0f;
+		};
+		void MixCachedHitVoice(FCachedHitVoice& InOutVoice, float* OutAudio, int32 InNumSamples);
+		//The hit being played back, and the one before it fading out after a retrigger
+		FCachedHitVoice CachedHit;
+		FCachedHitVoice FadingHit;
+		float PreviousAttackTime{ -1.f };
+		float PreviousDecayTime{ -1.f };
+		float PreviousAttackCurve{ -1.f };
+		float PreviousDecayCurve{ -1.f };
+		//One-pole detector coefficients for Follower mode, rebuilt when the Attack or Decay time changes
+		float FollowerAttackCoefficient = 1.0f;
+		float FollowerReleaseCoefficient = 1.0f;
+		float PreviousFollowerAttackTime = -1.0f;
+		float PreviousFollowerDecayTime = -1.0f;
+		FLowPassGateBudgetVoice BudgetVoice;
+	};
+
+	using FLowPassGateOperator = TLowPassGateOperator<1>;
+
+	//Instantiated in BuchlaLowPassGate.cpp for every channel count that has a node
+	extern template class TLowPassGateOperator<1>;
+	extern template class TLowPassGateOperator<2>;
+	extern template class TLowPassGateOperator<4>;
+	extern template class TLowPassGateOperator<6>;
+	extern template class TLowPassGateOperator<8>;
+}
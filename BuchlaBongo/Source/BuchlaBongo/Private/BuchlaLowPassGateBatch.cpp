@@ -0,0 +1,105 @@
+#include "BuchlaLowPassGateBatch.h"
+#include "BuchlaLowPassGateHarness.h"
+#include "Async/ParallelFor.h"
+#include "Misc/App.h"
+#include "BuchlaBongoStats.h"
+
+namespace Metasound
+{
+	namespace LowPassGateBatch
+	{
+		//Per-worker context, built on the calling thread and reused from job to job
+		//The harness is only rebuilt when a job needs a different sample rate
+		struct FWorker
+		{
+			TUniquePtr<FLowPassGateHarness> Harness;
+			float SampleRate = 0.0f;
+
+			FLowPassGateHarness& GetHarness(float InSampleRate, int32 InBlockSize)
+			{
+				if (!Harness.IsValid() || SampleRate != InSampleRate)
+				{
+					Harness = MakeUnique<FLowPassGateHarness>(InSampleRate, InBlockSize, ELowPassGateMode::Both);
+					SampleRate = InSampleRate;
+				}
+				return *Harness;
+			}
+
+			void Render(const FLowPassGateBatchJob& InJob, int32 InBlockSize, TArray<float>& OutResult)
+			{
+				TRACE_CPUPROFILER_EVENT_SCOPE(BuchlaBongo::BatchJob);
+
+				FLowPassGateHarness& Voice = GetHarness(InJob.Params.SampleRate, InBlockSize);
+				Voice.ApplyParams(InJob.Params);
+
+				const FAudioBuffer& AudioOut = Voice.GetOutput(0);
+				const int32 NumFrames = Voice.GetNumFramesPerBlock();
+				const int32 NumJobFrames = OutResult.Num();
+				int32 NextTrigger = 0;
+
+				for (int32 BlockStart = 0; BlockStart < NumJobFrames; BlockStart += NumFrames)
+				{
+					Voice.LoadInputBlock(InJob.Input, BlockStart);
+
+					while (NextTrigger < InJob.TriggerFrames.Num() && InJob.TriggerFrames[NextTrigger] < BlockStart + NumFrames)
+					{
+						Voice.Trigger->TriggerFrame(FMath::Max(0, InJob.TriggerFrames[NextTrigger] - BlockStart));
+						++NextTrigger;
+					}
+
+					Voice.RenderBlock();
+
+					const int32 NumOutputInBlock = FMath::Min(NumFrames, NumJobFrames - BlockStart);
+					FMemory::Memcpy(OutResult.GetData() + BlockStart, AudioOut.GetData(), sizeof(float) * NumOutputInBlock);
+				}
+			}
+		};
+
+		static int32 GetNumWorkers(int32 InNumJobs, bool bInSingleThreaded)
+		{
+			if (bInSingleThreaded || !FApp::ShouldUseThreadingForPerformance())
+			{
+				return FMath::Min(InNumJobs, 1);
+			}
+			//The calling thread works through jobs as well
+			return FMath::Min(InNumJobs, FTaskGraphInterface::Get().GetNumWorkerThreads() + 1);
+		}
+	}
+
+	void FLowPassGateBatchRenderer::Render(TArrayView<const FLowPassGateBatchJob> InJobs, TArray<TArray<float>>& OutResults, int32 InBlockSize, bool bInSingleThreaded)
+	{
+		using namespace LowPassGateBatch;
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(BuchlaBongo::RenderBatch);
+
+		OutResults.SetNum(InJobs.Num());
+		for (int32 JobIndex = 0; JobIndex < InJobs.Num(); ++JobIndex)
+		{
+			const FLowPassGateBatchJob& Job = InJobs[JobIndex];
+			OutResults[JobIndex].SetNumUninitialized(Job.NumFrames > 0 ? Job.NumFrames : Job.Input.Num());
+		}
+
+		const int32 NumWorkers = GetNumWorkers(InJobs.Num(), bInSingleThreaded);
+		if (NumWorkers == 0)
+		{
+			return;
+		}
+
+		//Every worker gets its harness here, at the rate of the first job, so the task threads only allocate for a job at another rate
+		TArray<FWorker> Workers;
+		Workers.SetNum(NumWorkers);
+		for (FWorker& Worker : Workers)
+		{
+			Worker.GetHarness(InJobs[0].Params.SampleRate, InBlockSize);
+		}
+
+		const EParallelForFlags Flags = EParallelForFlags::Unbalanced | (NumWorkers == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+		ParallelForWithExistingTaskContext(TEXT("BuchlaBongo.RenderBatch"), MakeArrayView(Workers), InJobs.Num(), 1,
+			[&](FWorker& InWorker, int32 InJobIndex)
+			{
+				InWorker.Render(InJobs[InJobIndex], InBlockSize, OutResults[InJobIndex]);
+			},
+			Flags);
+	}
+}
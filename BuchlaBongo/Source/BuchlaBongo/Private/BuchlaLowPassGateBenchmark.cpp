@@ -0,0 +1,238 @@
+#include "BuchlaLowPassGateHarness.h"
+#include "BuchlaLowPassGateBatch.h"
+#include "BuchlaLowPassGateControl.h"
+
+#if BUCHLABONGO_WITH_DEV_TOOLS
+
+#include "BuchlaBongo.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/PlatformMisc.h"
+
+namespace Metasound
+{
+	namespace LowPassGateBenchmark
+	{
+		static const TCHAR* ModeNames[] = { TEXT("LowPass"), TEXT("VCA"), TEXT("Both"), TEXT("Vactrol"), TEXT("Follower") };
+		static const ELowPassGateMode Modes[] = { ELowPassGateMode::LowPass, ELowPassGateMode::VCA, ELowPassGateMode::Both, ELowPassGateMode::Vactrol, ELowPassGateMode::Follower };
+		static const int32 BlockSizes[] = { 64, 128, 256, 512, 1024, 2048 };
+		static const float SampleRates[] = { 44100.0f, 48000.0f, 96000.0f };
+		static const float TriggersPerSecond[] = { 0.0f, 4.0f, 32.0f };
+		static const int32 InstanceCounts[] = { 1, 16, 64 };
+
+		struct FResult
+		{
+			double NanosecondsPerSample = 0.0;
+			double AllocationsPerBlock = 0.0;
+		};
+
+		//Renders InSeconds of audio through InNumInstances gates and times only the Execute() calls
+		FResult RunCase(ELowPassGateMode InMode, float InSampleRate, int32 InBlockSize, float InTriggersPerSecond, int32 InNumInstances, float InSeconds)
+		{
+			FLowPassGateHarness Harness(InSampleRate, InBlockSize, InMode, InNumInstances);
+			Harness.FillInputWithNoise(1234u);
+
+			const int32 NumFrames = Harness.GetNumFramesPerBlock();
+			const int32 NumBlocks = FMath::Max(1, FMath::CeilToInt(InSeconds * InSampleRate / NumFrames));
+			const double FramesPerTrigger = InTriggersPerSecond > 0.0f ? InSampleRate / InTriggersPerSecond : 0.0;
+
+			//A few untimed blocks so first-block parameter setup is not part of the measurement
+			//A triggered case also hits once here, that grows the trigger outputs' frame lists the way any first hit in a live graph does
+			if (FramesPerTrigger > 0.0)
+			{
+				Harness.Trigger->TriggerFrame(0);
+			}
+			for (int32 Block = 0; Block < 4; ++Block)
+			{
+				Harness.RenderBlock();
+			}
+
+			const int32 AllocationsBefore = BuchlaBongoAllocations::GetNumRenderAllocations();
+			double NextTriggerFrame = 0.0;
+			uint64 Cycles = 0;
+
+			for (int32 Block = 0; Block < NumBlocks; ++Block)
+			{
+				const double BlockStart = (double)Block * NumFrames;
+				while (FramesPerTrigger > 0.0 && NextTriggerFrame < BlockStart + NumFrames)
+				{
+					Harness.Trigger->TriggerFrame((int32)(NextTriggerFrame - BlockStart));
+					NextTriggerFrame += FramesPerTrigger;
+				}
+
+				const uint64 StartCycles = FPlatformTime::Cycles64();
+				Harness.RenderBlock();
+				Cycles += FPlatformTime::Cycles64() - StartCycles;
+			}
+
+			FResult Result;
+			const double NumSamples = (double)NumBlocks * NumFrames * InNumInstances;
+			Result.NanosecondsPerSample = FPlatformTime::ToSeconds64(Cycles) * 1.0e9 / NumSamples;
+			Result.AllocationsPerBlock = (double)(BuchlaBongoAllocations::GetNumRenderAllocations() - AllocationsBefore) / NumBlocks;
+
+			return Result;
+		}
+
+		void Run(const TArray<FString>& InArgs)
+		{
+			//Seconds of audio rendered per case, kept short so the full sweep finishes in a few seconds
+			const float Seconds = InArgs.Num() > 0 ? FMath::Max(0.01f, FCString::Atof(*InArgs[0])) : 0.25f;
+
+#if !BUCHLABONGO_RENDER_ALLOCATION_CHECKS
+			UE_LOG(LogBuchlaBongo, Warning, TEXT("Render allocation checks are compiled out, allocs/block will always read 0"));
+#endif
+			//Counts every heap allocation Execute() makes for the length of the sweep
+			BuchlaBongoAllocations::FScopedAllocationTracking AllocationTracking;
+			UE_LOG(LogBuchlaBongo, Display, TEXT("Buchla Low Pass Gate benchmark, %.2fs of audio per case"), Seconds);
+			UE_LOG(LogBuchlaBongo, Display, TEXT("%-8s %8s %6s %8s %10s %12s %12s"), TEXT("Mode"), TEXT("Rate"), TEXT("Block"), TEXT("Hits/s"), TEXT("Instances"), TEXT("ns/sample"), TEXT("allocs/block"));
+
+			for (int32 ModeIndex = 0; ModeIndex < UE_ARRAY_COUNT(Modes); ++ModeIndex)
+			{
+				double TotalNanoseconds = 0.0;
+				int32 NumCases = 0;
+
+				for (float SampleRate : SampleRates)
+				{
+					for (int32 BlockSize : BlockSizes)
+					{
+						for (float Triggers : TriggersPerSecond)
+						{
+							for (int32 Instances : InstanceCounts)
+							{
+								const FResult Result = RunCase(Modes[ModeIndex], SampleRate, BlockSize, Triggers, Instances, Seconds);
+								UE_LOG(LogBuchlaBongo, Display, TEXT("%-8s %8.0f %6d %8.0f %10d %12.2f %12.3f"), ModeNames[ModeIndex], SampleRate, BlockSize, Triggers, Instances, Result.NanosecondsPerSample, Result.AllocationsPerBlock);
+
+								TotalNanoseconds += Result.NanosecondsPerSample;
+								++NumCases;
+							}
+						}
+					}
+				}
+
+				UE_LOG(LogBuchlaBongo, Display, TEXT("%s mean %.2f ns/sample over %d cases"), ModeNames[ModeIndex], TotalNanoseconds / NumCases, NumCases);
+			}
+		}
+
+		//Triggered modes only, from one hit per block up to a trigger on every frame
+		//The cost per sample should stay flat as the density goes up, each trigger only restarts the envelope
+		void RunTriggerDensity(const TArray<FString>& InArgs)
+		{
+			const float Seconds = InArgs.Num() > 0 ? FMath::Max(0.01f, FCString::Atof(*InArgs[0])) : 0.25f;
+			constexpr float SampleRate = 48000.0f;
+			constexpr int32 BlockSize = 256;
+			static const int32 TriggersPerBlock[] = { 1, 4, 16, 64, 256 };
+
+			UE_LOG(LogBuchlaBongo, Display, TEXT("Buchla Low Pass Gate trigger density, %.2fs of audio at %.0f Hz, %d frame blocks"), Seconds, SampleRate, BlockSize);
+			UE_LOG(LogBuchlaBongo, Display, TEXT("%-8s %10s %12s %12s"), TEXT("Mode"), TEXT("Hits/block"), TEXT("ns/sample"), TEXT("vs 1/block"));
+
+			for (int32 ModeIndex = 0; ModeIndex < UE_ARRAY_COUNT(Modes); ++ModeIndex)
+			{
+				if (Modes[ModeIndex] == ELowPassGateMode::LowPass || Modes[ModeIndex] == ELowPassGateMode::Follower)
+				{
+					continue;
+				}
+
+				double BaselineNanoseconds = 0.0;
+				for (int32 Triggers : TriggersPerBlock)
+				{
+					const FResult Result = RunCase(Modes[ModeIndex], SampleRate, BlockSize, SampleRate * Triggers / BlockSize, 1, Seconds);
+					if (BaselineNanoseconds <= 0.0)
+					{
+						BaselineNanoseconds = Result.NanosecondsPerSample;
+					}
+					UE_LOG(LogBuchlaBongo, Display, TEXT("%-8s %10d %12.2f %11.2fx"), ModeNames[ModeIndex], Triggers, Result.NanosecondsPerSample, Result.NanosecondsPerSample / BaselineNanoseconds);
+				}
+			}
+		}
+
+		//Same jobs rendered on one thread and then across the task graph, the ratio is the batch scaling
+		void RunBatch(const TArray<FString>& InArgs)
+		{
+			const int32 NumJobs = InArgs.Num() > 0 ? FMath::Max(1, FCString::Atoi(*InArgs[0])) : 256;
+			constexpr float SampleRate = 48000.0f;
+			constexpr int32 NumJobFrames = 48000;
+
+			TArray<float> Input;
+			Input.SetNumUninitialized(NumJobFrames);
+			uint32 Seed = 1234u;
+			for (float& Sample : Input)
+			{
+				Seed = Seed * 1664525u + 1013904223u;
+				Sample = (float)(int32)Seed * (1.0f / 2147483648.0f);
+			}
+
+			TArray<FLowPassGateBatchJob> Jobs;
+			Jobs.SetNum(NumJobs);
+			for (int32 JobIndex = 0; JobIndex < NumJobs; ++JobIndex)
+			{
+				FLowPassGateBatchJob& Job = Jobs[JobIndex];
+				Job.Input = Input;
+				Job.Params.SampleRate = SampleRate;
+				Job.Params.Mode = Modes[JobIndex % UE_ARRAY_COUNT(Modes)];
+				Job.Params.CutOff = 500.0f + 10.0f * JobIndex;
+				Job.TriggerFrames = { 0, 12000, 24000, 36000 };
+			}
+
+			TArray<TArray<float>> Results;
+			double Seconds[2] = {};
+			for (int32 Pass = 0; Pass < 2; ++Pass)
+			{
+				const uint64 StartCycles = FPlatformTime::Cycles64();
+				FLowPassGateBatchRenderer::Render(Jobs, Results, FLowPassGateBatchRenderer::DefaultBlockSize, Pass == 0);
+				Seconds[Pass] = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles);
+			}
+
+			const double AudioSeconds = (double)NumJobs * NumJobFrames / SampleRate;
+			UE_LOG(LogBuchlaBongo, Display, TEXT("Buchla Low Pass Gate batch, %d jobs of %.1fs"), NumJobs, NumJobFrames / SampleRate);
+			UE_LOG(LogBuchlaBongo, Display, TEXT("Single thread: %.3fs (%.0fx realtime)"), Seconds[0], AudioSeconds / Seconds[0]);
+			UE_LOG(LogBuchlaBongo, Display, TEXT("Parallel: %.3fs (%.0fx realtime), %.2fx speed up with %d worker threads"), Seconds[1], AudioSeconds / Seconds[1], Seconds[0] / Seconds[1], FPlatformMisc::NumberOfWorkerThreadsToSpawn());
+		}
+
+		//Bytes per gate for every mode, and what a given number of gates would cost, the shared tables are listed once
+		void RunMemoryReport(const TArray<FString>& InArgs)
+		{
+			const int32 NumInstances = InArgs.Num() > 0 ? FMath::Max(1, FCString::Atoi(*InArgs[0])) : 1000;
+			constexpr float SampleRate = 48000.0f;
+			constexpr int32 BlockSize = 256;
+
+			UE_LOG(LogBuchlaBongo, Display, TEXT("Buchla Low Pass Gate memory at %.0f Hz, %d frame blocks"), SampleRate, BlockSize);
+			UE_LOG(LogBuchlaBongo, Display, TEXT("Operator %d bytes inline, %d bytes of per-block state"), (int32)sizeof(FLowPassGateOperator), (int32)FLowPassGateOperator::GetHotStateSize());
+			UE_LOG(LogBuchlaBongo, Display, TEXT("%-8s %12s %16s"), TEXT("Mode"), TEXT("bytes/gate"), *FString::Printf(TEXT("KiB/%d gates"), NumInstances));
+
+			for (int32 ModeIndex = 0; ModeIndex < UE_ARRAY_COUNT(Modes); ++ModeIndex)
+			{
+				FLowPassGateHarness Harness(SampleRate, BlockSize, Modes[ModeIndex]);
+				Harness.RenderBlock();
+
+				const SIZE_T Bytes = Harness.GetOperator(0).GetAllocatedSize();
+				UE_LOG(LogBuchlaBongo, Display, TEXT("%-8s %12d %16.1f"), ModeNames[ModeIndex], (int32)Bytes, (double)Bytes * NumInstances / 1024.0);
+			}
+
+			UE_LOG(LogBuchlaBongo, Display, TEXT("A non-zero Gate ID adds %d bytes for its update queue"), (int32)(FLowPassGateControl::QueueCapacity * sizeof(FLowPassGateUpdate)));
+			UE_LOG(LogBuchlaBongo, Display, TEXT("Shared per sample rate, whatever the number of gates: cut off table %d bytes, vactrol table %d bytes"),
+				(int32)LowPassGateDSP::FCutOffTable::Get(SampleRate)->GetAllocatedSize(), (int32)sizeof(LowPassGateDSP::FVactrolTable));
+		}
+
+		static FAutoConsoleCommand BenchmarkCommand(
+			TEXT("BuchlaBongo.Benchmark"),
+			TEXT("Times every Buchla Low Pass Gate mode across block sizes, sample rates, trigger densities and instance counts. Optional argument: seconds of audio per case."),
+			FConsoleCommandWithArgsDelegate::CreateStatic(&Run));
+
+		static FAutoConsoleCommand BatchBenchmarkCommand(
+			TEXT("BuchlaBongo.BatchBenchmark"),
+			TEXT("Renders a batch of one second Buchla Low Pass Gate jobs on one thread and then in parallel, and logs the speed up. Optional argument: number of jobs."),
+			FConsoleCommandWithArgsDelegate::CreateStatic(&RunBatch));
+
+		static FAutoConsoleCommand TriggerBenchmarkCommand(
+			TEXT("BuchlaBongo.TriggerBenchmark"),
+			TEXT("Times the Buchla Low Pass Gate envelope modes with up to a trigger on every frame. Optional argument: seconds of audio per case."),
+			FConsoleCommandWithArgsDelegate::CreateStatic(&RunTriggerDensity));
+
+		static FAutoConsoleCommand MemoryReportCommand(
+			TEXT("BuchlaBongo.MemoryReport"),
+			TEXT("Logs the bytes every Buchla Low Pass Gate instance owns, per mode. Optional argument: number of gates to total the footprint for."),
+			FConsoleCommandWithArgsDelegate::CreateStatic(&RunMemoryReport));
+	}
+}
+
+#endif
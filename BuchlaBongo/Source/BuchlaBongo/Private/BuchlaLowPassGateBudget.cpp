@@ -0,0 +1,206 @@
+#include "BuchlaLowPassGateBudget.h"
+#include "BuchlaBongo.h"
+#include "BuchlaBongoCVars.h"
+#include "BuchlaBongoStats.h"
+#include "HAL/PlatformTime.h"
+
+namespace Metasound
+{
+	//Share of each new block in the estimated block cost, about 50 blocks before a change in cost is fully reported
+	static constexpr float BlockCostSmoothing = 0.02f;
+	//Per-block decay of the recent output peak, a short gap between two hits does not get a voice culled
+	static constexpr float CullPeakDecay = 0.9f;
+	//With nobody stepping for this long the budget was off or nothing was rendering, so the old degradation no longer applies
+	static constexpr double StaleStepTime = 4.0 * FLowPassGateBudget::StepInterval;
+
+	FLowPassGateBudget& FLowPassGateBudget::Get()
+	{
+		static FLowPassGateBudget Budget;
+		return Budget;
+	}
+
+	int32 FLowPassGateBudget::GetLoudness(float InPeak)
+	{
+		//One level per halving of the peak, about 6dB
+		return FMath::Clamp(NumLoudnessLevels + FMath::FloorToInt(FMath::Log2(FMath::Max(InPeak, 1.0e-10f))), 0, NumLoudnessLevels - 1);
+	}
+
+	void FLowPassGateBudget::ReportLoad(int32& InOutReportedLoad, float InLoad)
+	{
+		const int32 Load = FMath::RoundToInt(FMath::Clamp(InLoad, 0.0f, 1000.0f) * LoadScale);
+		if (Load != InOutReportedLoad)
+		{
+			TotalLoad.fetch_add(Load - InOutReportedLoad, std::memory_order_relaxed);
+			InOutReportedLoad = Load;
+		}
+	}
+
+	void FLowPassGateBudget::ReportLoudness(int32& InOutReportedLoudness, int32 InLoudness)
+	{
+		if (InLoudness == InOutReportedLoudness)
+		{
+			return;
+		}
+
+		if (InOutReportedLoudness != INDEX_NONE)
+		{
+			NumRanked[InOutReportedLoudness].fetch_sub(1, std::memory_order_relaxed);
+		}
+		if (InLoudness != INDEX_NONE)
+		{
+			NumRanked[InLoudness].fetch_add(1, std::memory_order_relaxed);
+		}
+		InOutReportedLoudness = InLoudness;
+	}
+
+	int32 FLowPassGateBudget::FindCullLoudness(float InShare) const
+	{
+		int32 Counts[NumLoudnessLevels];
+		int32 NumVoices = 0;
+		for (int32 Level = 0; Level < NumLoudnessLevels; ++Level)
+		{
+			//Read while voices report, a level can briefly look one short or one over
+			Counts[Level] = FMath::Max(0, NumRanked[Level].load(std::memory_order_relaxed));
+			NumVoices += Counts[Level];
+		}
+
+		//Whole levels from the quietest up, stopping before the one that would take more than the share
+		const int32 MaxCulled = FMath::FloorToInt(NumVoices * InShare);
+		int32 NumCulled = 0;
+		int32 Loudness = 0;
+		for (; Loudness < NumLoudnessLevels - 1; ++Loudness)
+		{
+			if (NumCulled + Counts[Loudness] > MaxCulled)
+			{
+				break;
+			}
+			NumCulled += Counts[Loudness];
+		}
+		return NumCulled > 0 ? Loudness : 0;
+	}
+
+	void FLowPassGateBudget::Update()
+	{
+		const double Now = FPlatformTime::Seconds();
+		double LastStep = LastStepTime.load(std::memory_order_relaxed);
+		if (Now - LastStep < StepInterval || !LastStepTime.compare_exchange_strong(LastStep, Now, std::memory_order_relaxed))
+		{
+			return;
+		}
+
+		const float Budget = BuchlaBongoCVars::GetCpuBudget();
+		const int32 MaxLevel = Budget > 0.0f ? BuchlaBongoCVars::GetMaxDegradation() : 0;
+		const bool bIsStale = Now - LastStep > StaleStepTime;
+		const int32 PreviousLevel = bIsStale ? 0 : Degradation.load(std::memory_order_relaxed);
+		int32 Level = FMath::Min(PreviousLevel, MaxLevel);
+		float Share = bIsStale ? 0.0f : CullShare.load(std::memory_order_relaxed);
+		const float Pressure = Budget > 0.0f ? GetTotalLoad() / Budget : 0.0f;
+
+		if (Pressure > 1.0f)
+		{
+			//Culling tightens by taking a larger share of the voices, every other step is a level of its own
+			if (Level == (int32)ELowPassGateDegradation::CullQuietest)
+			{
+				Share = FMath::Min(Share * 2.0f, MaxCullShare);
+			}
+			else if (Level < MaxLevel)
+			{
+				++Level;
+				Share = Level == (int32)ELowPassGateDegradation::CullQuietest ? MinCullShare : 0.0f;
+			}
+		}
+		else if (Pressure < RecoverRatio && Level > 0)
+		{
+			//Back out in the reverse order, the louder voices come back first
+			if (Level == (int32)ELowPassGateDegradation::CullQuietest && Share > MinCullShare)
+			{
+				Share = FMath::Max(Share * 0.5f, MinCullShare);
+			}
+			else
+			{
+				--Level;
+				Share = 0.0f;
+			}
+		}
+
+		if (Level != (int32)ELowPassGateDegradation::CullQuietest)
+		{
+			Share = 0.0f;
+		}
+		CullShare.store(Share, std::memory_order_relaxed);
+		//Re-ranked every step, culled voices keep their place so the same share does not keep taking more voices
+		CullLoudness.store(Share > 0.0f ? FindCullLoudness(Share) : 0, std::memory_order_relaxed);
+		Degradation.store(Level, std::memory_order_relaxed);
+
+		CSV_CUSTOM_STAT(BuchlaBongo, LPGLoad, GetTotalLoad(), ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(BuchlaBongo, LPGDegradation, Level, ECsvCustomStatOp::Set);
+
+		if (Level != PreviousLevel)
+		{
+			UE_LOG(LogBuchlaBongo, Log, TEXT("Buchla Low Pass Gate load is %.3f against a budget of %.3f, degradation %d -> %d"), GetTotalLoad(), Budget, PreviousLevel, Level);
+		}
+	}
+
+	void FLowPassGateBudgetVoice::SetEnabled(bool bInEnabled)
+	{
+		bIsEnabled = bInEnabled;
+		if (!bIsEnabled)
+		{
+			Leave();
+			bIsMeasuring = false;
+		}
+	}
+
+	uint64 FLowPassGateBudgetVoice::BeginBlock()
+	{
+		bIsMeasuring = bIsEnabled && BuchlaBongoCVars::GetCpuBudget() > 0.0f;
+		if (!bIsMeasuring)
+		{
+			if (ReportedLoad != 0 || ReportedLoudness != INDEX_NONE)
+			{
+				Leave();
+			}
+			return 0;
+		}
+		return FPlatformTime::Cycles64();
+	}
+
+	void FLowPassGateBudgetVoice::EndBlock(uint64 InStartCycles, float InSampleRate, int32 InNumFrames)
+	{
+		if (!bIsMeasuring)
+		{
+			return;
+		}
+
+		const float BlockCost = (float)FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - InStartCycles);
+		EstimatedBlockCost = bHasEstimate ? EstimatedBlockCost + (BlockCost - EstimatedBlockCost) * BlockCostSmoothing : BlockCost;
+		bHasEstimate = true;
+
+		FLowPassGateBudget& Budget = FLowPassGateBudget::Get();
+		Budget.ReportLoad(ReportedLoad, EstimatedBlockCost * InSampleRate / FMath::Max(1, InNumFrames));
+		Budget.Update();
+	}
+
+	bool FLowPassGateBudgetVoice::ShouldCull(float InBlockPeak)
+	{
+		RecentPeak = FMath::Max(InBlockPeak, RecentPeak * CullPeakDecay);
+
+		FLowPassGateBudget& Budget = FLowPassGateBudget::Get();
+		const int32 Loudness = FLowPassGateBudget::GetLoudness(RecentPeak);
+		Budget.ReportLoudness(ReportedLoudness, Loudness);
+		return Loudness < Budget.GetCullLoudness();
+	}
+
+	bool FLowPassGateBudgetVoice::IsAboveCull(float InPeak) const
+	{
+		return !bIsMeasuring || FLowPassGateBudget::GetLoudness(InPeak) >= FLowPassGateBudget::Get().GetCullLoudness();
+	}
+
+	void FLowPassGateBudgetVoice::Leave()
+	{
+		FLowPassGateBudget& Budget = FLowPassGateBudget::Get();
+		Budget.RemoveLoad(ReportedLoad);
+		Budget.RemoveLoudness(ReportedLoudness);
+		bHasEstimate = false;
+	}
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+namespace Metasound
+{
+	//Steps taken in order while the gates are over au.BuchlaBongo.CpuBudget, every step keeps the ones before it
+	enum class ELowPassGateDegradation : int32
+	{
+		None,
+		//The envelope is evaluated every DegradedControlRate samples and interpolated in between
+		ControlRateEnvelope,
+		//Oversampling is ignored and the filter runs at the graph rate
+		NoOversampling,
+		//Voices ranked quieter than GetCullLoudness() fade out over one block and sleep
+		CullQuietest
+	};
+
+	//Sums the load every voice reports and decides how far the voices are degraded to keep it within the budget
+	//Lock-free, voices rendering on any number of audio threads report into it at the end of every block
+	class BUCHLABONGO_API FLowPassGateBudget
+	{
+	public:
+		static constexpr int32 DegradedControlRate = 16;
+		//Seconds between two steps of the degradation, long enough for the load to settle after the previous one
+		static constexpr double StepInterval = 0.25;
+		//Degradation only steps back once the load has fallen this far under the budget, so it does not flip every step
+		static constexpr float RecoverRatio = 0.7f;
+		//Share of the ranked voices culled, doubling every step while still over budget
+		//Never more than half, a crowd of equally loud voices has no quiet ones to pick
+		static constexpr float MinCullShare = 0.125f;
+		static constexpr float MaxCullShare = 0.5f;
+		//Voices are ranked in 6dB steps of their recent output peak, from -96dB up to full scale
+		static constexpr int32 NumLoudnessLevels = 16;
+
+		static FLowPassGateBudget& Get();
+
+		static int32 GetLoudness(float InPeak);
+
+		//Swaps the voice's previous report in InOutReportedLoad for InLoad, its cost per block over the duration of a block
+		void ReportLoad(int32& InOutReportedLoad, float InLoad);
+		void RemoveLoad(int32& InOutReportedLoad) { ReportLoad(InOutReportedLoad, 0.0f); }
+		//Moves the voice's place in the ranking from InOutReportedLoudness to InLoudness, INDEX_NONE is not ranked
+		void ReportLoudness(int32& InOutReportedLoudness, int32 InLoudness);
+		void RemoveLoudness(int32& InOutReportedLoudness) { ReportLoudness(InOutReportedLoudness, INDEX_NONE); }
+		//Moves the degradation at most one step per StepInterval, whichever voice calls it first after that does the work
+		void Update();
+
+		//Sum of every voice's load, 1 being one core spending all its time on the plugin's voices
+		float GetTotalLoad() const { return TotalLoad.load(std::memory_order_relaxed) / LoadScale; }
+		ELowPassGateDegradation GetDegradation() const { return (ELowPassGateDegradation)Degradation.load(std::memory_order_relaxed); }
+		//Voices ranked below this loudness are released, 0 unless the voices are being culled
+		int32 GetCullLoudness() const { return CullLoudness.load(std::memory_order_relaxed); }
+
+	private:
+		//The loudness the quietest InShare of the ranked voices sit under, as a whole level so equally loud voices go together
+		int32 FindCullLoudness(float InShare) const;
+
+		//The load is summed as an integer so reports never drift apart from their removal
+		static constexpr float LoadScale = 1000000.0f;
+
+		std::atomic<int64> TotalLoad{ 0 };
+		std::atomic<int32> Degradation{ (int32)ELowPassGateDegradation::None };
+		std::atomic<int32> NumRanked[NumLoudnessLevels] = {};
+		std::atomic<float> CullShare{ 0.0f };
+		std::atomic<int32> CullLoudness{ 0 };
+		std::atomic<double> LastStepTime{ 0.0 };
+	};
+
+	//One voice's part in FLowPassGateBudget, kept by every operator that renders voices
+	//Nothing is timed or reported while au.BuchlaBongo.CpuBudget is 0, the voice's reports are taken out once when it is turned off
+	class BUCHLABONGO_API FLowPassGateBudgetVoice
+	{
+	public:
+		FLowPassGateBudgetVoice() = default;
+		~FLowPassGateBudgetVoice() { Leave(); }
+
+		FLowPassGateBudgetVoice(const FLowPassGateBudgetVoice&) = delete;
+		FLowPassGateBudgetVoice& operator=(const FLowPassGateBudgetVoice&) = delete;
+
+		//Offline renders should neither count towards the budget nor be degraded by it
+		void SetEnabled(bool bInEnabled);
+
+		//Called at the start of every block, decides whether the block is measured and returns the cycle count to pass to EndBlock
+		uint64 BeginBlock();
+		//Reports the cost of the block started with InStartCycles, then gives the budget its chance to step
+		void EndBlock(uint64 InStartCycles, float InSampleRate, int32 InNumFrames);
+		//Whether the block started by BeginBlock is being measured, false without a budget
+		bool IsMeasuring() const { return bIsMeasuring; }
+
+		ELowPassGateDegradation GetDegradation() const { return bIsMeasuring ? FLowPassGateBudget::Get().GetDegradation() : ELowPassGateDegradation::None; }
+
+		//Ranks the voice by InBlockPeak, returns true if it is one of the quietest and should be released
+		bool ShouldCull(float InBlockPeak);
+		//Whether a culled voice seeing InPeak would be loud enough to keep its place
+		bool IsAboveCull(float InPeak) const;
+		//A voice that wakes from culling starts at full scale, so the attack of a new hit is never taken for a quiet voice
+		void ResetPeak() { RecentPeak = 1.0f; }
+		//Idle voices cost nothing and drop out of the ranking, culled voices keep their place so the ranking does not creep upwards
+		void LeaveRanking() { FLowPassGateBudget::Get().RemoveLoudness(ReportedLoudness); }
+
+		//Smoothed seconds the owner's Execute() takes per block, this is what the voice reports
+		float GetEstimatedBlockCost() const { return EstimatedBlockCost; }
+
+	private:
+		void Leave();
+
+		float EstimatedBlockCost = 0.0f;
+		//Output peak decaying block by block, this is what the voice is ranked by
+		float RecentPeak = 1.0f;
+		int32 ReportedLoad = 0;
+		int32 ReportedLoudness = INDEX_NONE;
+		bool bIsEnabled = true;
+		bool bIsMeasuring = false;
+		//Cleared whenever the voice stops reporting, the first block measured after that is taken as the estimate
+		bool bHasEstimate = false;
+	};
+}
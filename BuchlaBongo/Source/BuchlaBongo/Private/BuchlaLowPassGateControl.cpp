@@ -0,0 +1,66 @@
+#include "BuchlaLowPassGateControl.h"
+#include "BuchlaBongo.h"
+#include "Misc/ScopeLock.h"
+
+namespace Metasound
+{
+	FLowPassGateControl& FLowPassGateControl::Get()
+	{
+		static FLowPassGateControl Control;
+		return Control;
+	}
+
+	void FLowPassGateControl::Send(TArrayView<const FLowPassGateUpdate> InUpdates)
+	{
+		FScopeLock Lock(&QueuesCritSection);
+
+		for (const FLowPassGateUpdate& Update : InUpdates)
+		{
+			TArray<FGateQueue>* GateQueues = Queues.Find(Update.GateId);
+			if (!GateQueues)
+			{
+				continue;
+			}
+
+			for (FGateQueue& GateQueue : *GateQueues)
+			{
+				//An empty queue has been drained since it filled up, so the gate is rendering again
+				if (GateQueue.bHasWarnedFull && GateQueue.Queue->IsEmpty())
+				{
+					GateQueue.bHasWarnedFull = false;
+				}
+
+				//A full queue means the gate has stopped rendering, dropping the update is all that can be done
+				if (!GateQueue.Queue->Enqueue(Update) && !GateQueue.bHasWarnedFull)
+				{
+					UE_LOG(LogBuchlaBongo, Warning, TEXT("Buchla Low Pass Gate update queue for Gate ID %d is full, updates are being dropped"), Update.GateId);
+					GateQueue.bHasWarnedFull = true;
+				}
+			}
+		}
+	}
+
+	FLowPassGateUpdateQueuePtr FLowPassGateControl::Register(int32 InGateId)
+	{
+		FLowPassGateUpdateQueuePtr Queue = MakeShared<FLowPassGateUpdateQueue, ESPMode::ThreadSafe>(QueueCapacity);
+
+		FScopeLock Lock(&QueuesCritSection);
+		Queues.FindOrAdd(InGateId).Add(FGateQueue{ Queue });
+
+		return Queue;
+	}
+
+	void FLowPassGateControl::Unregister(int32 InGateId, const FLowPassGateUpdateQueuePtr& InQueue)
+	{
+		FScopeLock Lock(&QueuesCritSection);
+
+		if (TArray<FGateQueue>* GateQueues = Queues.Find(InGateId))
+		{
+			GateQueues->RemoveAllSwap([&InQueue](const FGateQueue& InGateQueue) { return InGateQueue.Queue == InQueue; });
+			if (GateQueues->Num() == 0)
+			{
+				Queues.Remove(InGateId);
+			}
+		}
+	}
+}
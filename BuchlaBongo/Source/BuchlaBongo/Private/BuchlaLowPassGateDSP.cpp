@@ -0,0 +1,74 @@
+#include "BuchlaLowPassGateDSP.h"
+#include "Misc/ScopeLock.h"
+
+namespace Metasound
+{
+	namespace LowPassGateDSP
+	{
+		namespace Private
+		{
+			//Tables are only ever built when operators are created, never on the render thread
+			template<typename TableType>
+			TSharedRef<const TableType> GetTableForSampleRate(float InSampleRate)
+			{
+				static FCriticalSection TableCritSection;
+				static TMap<int32, TSharedRef<const TableType>> Tables;
+
+				const int32 SampleRateKey = FMath::RoundToInt(InSampleRate);
+
+				FScopeLock Lock(&TableCritSection);
+				if (const TSharedRef<const TableType>* Table = Tables.Find(SampleRateKey))
+				{
+					return *Table;
+				}
+
+				TSharedRef<const TableType> Table = MakeShared<TableType>(InSampleRate);
+				Tables.Add(SampleRateKey, Table);
+
+				return Table;
+			}
+		}
+
+		TSharedRef<const FCutOffTable> FCutOffTable::Get(float InSampleRate)
+		{
+			return Private::GetTableForSampleRate<FCutOffTable>(InSampleRate);
+		}
+
+		FCutOffTable::FCutOffTable(float InSampleRate)
+		{
+			//Covers MinFrequency up to just below Nyquist, where FSVFCoefficients also stops
+			const float MaxFrequency = 0.49f * InSampleRate;
+			const float NumOctaves = FrequencyToOctaves(MaxFrequency);
+			const int32 NumEntries = FMath::CeilToInt(NumOctaves * NumEntriesPerOctave) + 1;
+
+			//One guard entry so GetG can always read Index + 1
+			Values.SetNumUninitialized(NumEntries + 1);
+			for (int32 Index = 0; Index < NumEntries; ++Index)
+			{
+				const float Frequency = FMath::Min(MinFrequency * FMath::Pow(2.0f, (float)Index / NumEntriesPerOctave), MaxFrequency);
+				Values[Index] = FMath::Tan(PI * Frequency / InSampleRate);
+			}
+			Values[NumEntries] = Values[NumEntries - 1];
+
+			MaxPosition = NumOctaves * NumEntriesPerOctave;
+		}
+
+		TSharedRef<const FVactrolTable> FVactrolTable::Get(float InSampleRate)
+		{
+			return Private::GetTableForSampleRate<FVactrolTable>(InSampleRate);
+		}
+
+		FVactrolTable::FVactrolTable(float InSampleRate)
+		{
+			AttackCoefficient = 1.0f - FMath::Exp(-1.0f / (AttackTime * InSampleRate));
+
+			//Decay slows down quadratically as the cell goes dark
+			for (int32 Index = 0; Index <= NumDecayEntries; ++Index)
+			{
+				const float Darkness = 1.0f - (float)Index / NumDecayEntries;
+				const float DecayTime = MinDecayTime + (MaxDecayTime - MinDecayTime) * Darkness * Darkness;
+				DecayCoefficients[Index] = 1.0f - FMath::Exp(-1.0f / (DecayTime * InSampleRate));
+			}
+		}
+	}
+}
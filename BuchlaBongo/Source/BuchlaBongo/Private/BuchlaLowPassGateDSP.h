@@ -0,0 +1,611 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/VectorRegister.h"
+
+namespace Metasound
+{
+	namespace LowPassGateDSP
+	{
+		//Roughly -100dB, anything below this is treated as silence by the gate's sleep mode
+		constexpr float SilenceThreshold = 1.0e-5f;
+
+		//Filter state below this is flushed to zero so decaying tails never reach subnormal arithmetic
+		constexpr float DenormalThreshold = 1.0e-15f;
+
+		FORCEINLINE float FlushDenormal(float InValue)
+		{
+			return FMath::Abs(InValue) < DenormalThreshold ? 0.0f : InValue;
+		}
+
+		//Runs on every sleeping gate every block, four samples at a time through VectorRegister4Float so it is SIMD on SSE and NEON alike
+		FORCEINLINE float GetPeak(const float* InSamples, int32 InNumSamples)
+		{
+			int32 i = 0;
+			VectorRegister4Float VectorPeak = VectorZeroFloat();
+			for (; i + 4 <= InNumSamples; i += 4)
+			{
+				VectorPeak = VectorMax(VectorPeak, VectorAbs(VectorLoad(&InSamples[i])));
+			}
+
+			alignas(16) float Lanes[4];
+			VectorStoreAligned(VectorPeak, Lanes);
+			float Peak = FMath::Max(FMath::Max(Lanes[0], Lanes[1]), FMath::Max(Lanes[2], Lanes[3]));
+
+			for (; i < InNumSamples; ++i)
+			{
+				Peak = FMath::Max(Peak, FMath::Abs(InSamples[i]));
+			}
+			return Peak;
+		}
+
+		//Coefficients for the same topology preserving state variable filter as Audio::FStateVariableFilter
+		//Kept separate from the filter state so the gate can run the filter one sample at a time inside its own loops
+		struct FSVFCoefficients
+		{
+			float G = 0.0f;
+			float K = 2.0f;
+			float H = 1.0f;
+
+			void Set(float InFrequency, float InQ, float InSampleRate)
+			{
+				//tan() blows up at Nyquist so keep the cut off just below it
+				const float Frequency = FMath::Clamp(InFrequency, 0.0f, 0.49f * InSampleRate);
+
+				G = FMath::Tan(PI * Frequency / InSampleRate);
+				K = 1.0f / FMath::Max(InQ, 0.5f);
+				H = 1.0f / (1.0f + G * (G + K));
+			}
+
+			//Used by the modulated paths where G comes from FCutOffTable instead of tan()
+			FORCEINLINE void SetG(float InG)
+			{
+				G = InG;
+				H = 1.0f / (1.0f + G * (G + K));
+			}
+		};
+
+		//Precomputed cut off to filter G table so cut off can be modulated per sample without any trigonometry
+		//The table is indexed in octaves above MinFrequency, one table is shared by all gates at the same sample rate
+		class FCutOffTable
+		{
+		public:
+			static constexpr float MinFrequency = 20.0f;
+			static constexpr int32 NumEntriesPerOctave = 48;
+
+			static TSharedRef<const FCutOffTable> Get(float InSampleRate);
+
+			explicit FCutOffTable(float InSampleRate);
+
+			static FORCEINLINE float FrequencyToOctaves(float InFrequency)
+			{
+				return FMath::Log2(FMath::Max(InFrequency, MinFrequency) / MinFrequency);
+			}
+
+			FORCEINLINE float GetG(float InOctaves) const
+			{
+				const float Position = FMath::Clamp(InOctaves * NumEntriesPerOctave, 0.0f, MaxPosition);
+				const int32 Index = (int32)Position;
+				const float Alpha = Position - (float)Index;
+				const float* Data = Values.GetData();
+
+				return Data[Index] + Alpha * (Data[Index + 1] - Data[Index]);
+			}
+
+			SIZE_T GetAllocatedSize() const { return sizeof(*this) + Values.GetAllocatedSize(); }
+
+		private:
+			TArray<float> Values;
+			float MaxPosition = 0.0f;
+		};
+
+		//Response of the vactrol (LED + photoresistor) in the Buchla low pass gate
+		//The cell lights up quickly but its resistance recovers more slowly the darker it gets, giving the long natural tails
+		class FVactrolTable
+		{
+		public:
+			static constexpr float AttackTime = 0.0025f;
+			static constexpr float MinDecayTime = 0.03f;
+			static constexpr float MaxDecayTime = 0.33f;
+			//How far below the Cut Off the filter closes when the cell is dark
+			static constexpr float CutOffRangeOctaves = 7.0f;
+			static constexpr int32 NumDecayEntries = 64;
+
+			static TSharedRef<const FVactrolTable> Get(float InSampleRate);
+
+			explicit FVactrolTable(float InSampleRate);
+
+			//One-pole coefficient for the current cell level, so there is no exp() in the per-sample loop
+			FORCEINLINE float GetCoefficient(float InDrive, float InLevel) const
+			{
+				if (InDrive > InLevel)
+				{
+					return AttackCoefficient;
+				}
+
+				const float Position = FMath::Clamp(InLevel, 0.0f, 1.0f) * NumDecayEntries;
+				const int32 Index = FMath::Min((int32)Position, NumDecayEntries - 1);
+				const float Alpha = Position - (float)Index;
+
+				return DecayCoefficients[Index] + Alpha * (DecayCoefficients[Index + 1] - DecayCoefficients[Index]);
+			}
+
+			//Polynomial stand-in for the cell conductance to gain curve
+			static FORCEINLINE float GetGain(float InLevel)
+			{
+				return InLevel * InLevel;
+			}
+
+		private:
+			float AttackCoefficient = 1.0f;
+			float DecayCoefficients[NumDecayEntries + 1];
+		};
+
+		struct FSVFState
+		{
+			float Z1 = 0.0f;
+			float Z2 = 0.0f;
+
+			void Reset()
+			{
+				Z1 = 0.0f;
+				Z2 = 0.0f;
+			}
+
+			void FlushDenormals()
+			{
+				Z1 = FlushDenormal(Z1);
+				Z2 = FlushDenormal(Z2);
+			}
+
+			bool IsSilent() const
+			{
+				return FMath::Abs(Z1) < SilenceThreshold && FMath::Abs(Z2) < SilenceThreshold;
+			}
+		};
+
+		FORCEINLINE float ProcessLowPassSample(const FSVFCoefficients& InCoefficients, FSVFState& InOutState, float InSample)
+		{
+			const float HighPass = (InSample - (InCoefficients.K + InCoefficients.G) * InOutState.Z1 - InOutState.Z2) * InCoefficients.H;
+			const float BandPass = InCoefficients.G * HighPass + InOutState.Z1;
+			const float LowPass = InCoefficients.G * BandPass + InOutState.Z2;
+
+			InOutState.Z1 = InCoefficients.G * HighPass + BandPass;
+			InOutState.Z2 = InCoefficients.G * BandPass + LowPass;
+
+			return LowPass;
+		}
+
+		//Four filters sharing one set of coefficients, one per lane, the multichannel gate packs its channels into these
+		struct FSVFState4
+		{
+			VectorRegister4Float Z1 = VectorZeroFloat();
+			VectorRegister4Float Z2 = VectorZeroFloat();
+		};
+
+		//Same arithmetic as ProcessLowPassSample, InKPlusG is K + G broadcast to every lane
+		FORCEINLINE VectorRegister4Float ProcessLowPassSample4(const VectorRegister4Float& InG, const VectorRegister4Float& InKPlusG, const VectorRegister4Float& InH, FSVFState4& InOutState, const VectorRegister4Float& InSample)
+		{
+			const VectorRegister4Float HighPass = VectorMultiply(VectorSubtract(VectorSubtract(InSample, VectorMultiply(InKPlusG, InOutState.Z1)), InOutState.Z2), InH);
+			const VectorRegister4Float BandPass = VectorMultiplyAdd(InG, HighPass, InOutState.Z1);
+			const VectorRegister4Float LowPass = VectorMultiplyAdd(InG, BandPass, InOutState.Z2);
+
+			InOutState.Z1 = VectorMultiplyAdd(InG, HighPass, BandPass);
+			InOutState.Z2 = VectorMultiplyAdd(InG, BandPass, LowPass);
+
+			return LowPass;
+		}
+
+		//Four rows become four columns, so four frames of four channels turn into one register per frame holding every channel
+		FORCEINLINE void TransposeLanes(VectorRegister4Float& InOutA, VectorRegister4Float& InOutB, VectorRegister4Float& InOutC, VectorRegister4Float& InOutD)
+		{
+			const VectorRegister4Float AB01 = VectorShuffle(InOutA, InOutB, 0, 1, 0, 1);
+			const VectorRegister4Float AB23 = VectorShuffle(InOutA, InOutB, 2, 3, 2, 3);
+			const VectorRegister4Float CD01 = VectorShuffle(InOutC, InOutD, 0, 1, 0, 1);
+			const VectorRegister4Float CD23 = VectorShuffle(InOutC, InOutD, 2, 3, 2, 3);
+
+			InOutA = VectorShuffle(AB01, CD01, 0, 2, 0, 2);
+			InOutB = VectorShuffle(AB01, CD01, 1, 3, 1, 3);
+			InOutC = VectorShuffle(AB23, CD23, 0, 2, 0, 2);
+			InOutD = VectorShuffle(AB23, CD23, 1, 3, 1, 3);
+		}
+
+		//The filters of every channel packed four to a register, the last group's spare lanes run on silence and stay silent
+		template<int32 NumChannels>
+		struct TSVFStateLanes
+		{
+			static constexpr int32 NumGroups = (NumChannels + 3) / 4;
+
+			FSVFState4 Groups[NumGroups];
+
+			void Load(const FSVFState* InStates)
+			{
+				for (int32 Group = 0; Group < NumGroups; ++Group)
+				{
+					alignas(16) float Z1[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+					alignas(16) float Z2[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+					for (int32 Lane = 0; Lane < 4 && Group * 4 + Lane < NumChannels; ++Lane)
+					{
+						Z1[Lane] = InStates[Group * 4 + Lane].Z1;
+						Z2[Lane] = InStates[Group * 4 + Lane].Z2;
+					}
+					Groups[Group].Z1 = VectorLoadAligned(Z1);
+					Groups[Group].Z2 = VectorLoadAligned(Z2);
+				}
+			}
+
+			void Store(FSVFState* OutStates) const
+			{
+				for (int32 Group = 0; Group < NumGroups; ++Group)
+				{
+					alignas(16) float Z1[4];
+					alignas(16) float Z2[4];
+					VectorStoreAligned(Groups[Group].Z1, Z1);
+					VectorStoreAligned(Groups[Group].Z2, Z2);
+					for (int32 Lane = 0; Lane < 4 && Group * 4 + Lane < NumChannels; ++Lane)
+					{
+						OutStates[Group * 4 + Lane].Z1 = Z1[Lane];
+						OutStates[Group * 4 + Lane].Z2 = Z2[Lane];
+					}
+				}
+			}
+
+			//Filters frames InFrame to InFrame + 3 of every channel, each frame with its own coefficients and, if bApplyGain, its own gain
+			template<bool bApplyGain>
+			FORCEINLINE void ProcessFrames4(const FSVFCoefficients* InCoefficients, const float* InGains, const float* const* InAudio, float* const* OutAudio, int32 InFrame)
+			{
+				VectorRegister4Float G[4];
+				VectorRegister4Float KPlusG[4];
+				VectorRegister4Float H[4];
+				[[maybe_unused]] VectorRegister4Float Gains[4];
+				for (int32 Frame = 0; Frame < 4; ++Frame)
+				{
+					G[Frame] = VectorSetFloat1(InCoefficients[Frame].G);
+					KPlusG[Frame] = VectorSetFloat1(InCoefficients[Frame].K + InCoefficients[Frame].G);
+					H[Frame] = VectorSetFloat1(InCoefficients[Frame].H);
+					if constexpr (bApplyGain)
+					{
+						Gains[Frame] = VectorSetFloat1(InGains[Frame]);
+					}
+				}
+
+				VectorRegister4Float Lanes[NumGroups][4];
+				for (int32 Group = 0; Group < NumGroups; ++Group)
+				{
+					for (int32 Lane = 0; Lane < 4; ++Lane)
+					{
+						const int32 Channel = Group * 4 + Lane;
+						Lanes[Group][Lane] = Channel < NumChannels ? VectorLoad(&InAudio[Channel][InFrame]) : VectorZeroFloat();
+					}
+					TransposeLanes(Lanes[Group][0], Lanes[Group][1], Lanes[Group][2], Lanes[Group][3]);
+				}
+
+				//Frame by frame with the groups inside, so the groups' independent filters overlap in the pipeline
+				for (int32 Frame = 0; Frame < 4; ++Frame)
+				{
+					for (int32 Group = 0; Group < NumGroups; ++Group)
+					{
+						Lanes[Group][Frame] = ProcessLowPassSample4(G[Frame], KPlusG[Frame], H[Frame], Groups[Group], Lanes[Group][Frame]);
+						if constexpr (bApplyGain)
+						{
+							Lanes[Group][Frame] = VectorMultiply(Lanes[Group][Frame], Gains[Frame]);
+						}
+					}
+				}
+
+				for (int32 Group = 0; Group < NumGroups; ++Group)
+				{
+					TransposeLanes(Lanes[Group][0], Lanes[Group][1], Lanes[Group][2], Lanes[Group][3]);
+					for (int32 Lane = 0; Lane < 4 && Group * 4 + Lane < NumChannels; ++Lane)
+					{
+						VectorStore(Lanes[Group][Lane], &OutAudio[Group * 4 + Lane][InFrame]);
+					}
+				}
+			}
+		};
+
+		//Filters every channel through lanes in steps of four frames, returns how many frames were done, the rest is left to the caller
+		//InAdvanceFrame(Frame) is called once per frame in order, it updates InOutCoefficients for that frame and returns its gain
+		template<int32 NumChannels, bool bApplyGain, typename FrameFunctionType>
+		FORCEINLINE int32 ProcessLowPassLanes(FSVFState* InOutStates, FSVFCoefficients& InOutCoefficients, const float* const* InAudio, float* const* OutAudio, int32 InNumSamples, FrameFunctionType&& InAdvanceFrame)
+		{
+			TSVFStateLanes<NumChannels> Lanes;
+			Lanes.Load(InOutStates);
+
+			FSVFCoefficients FrameCoefficients[4];
+			float FrameGains[4];
+
+			int32 Frame = 0;
+			for (; Frame + 4 <= InNumSamples; Frame += 4)
+			{
+				for (int32 Offset = 0; Offset < 4; ++Offset)
+				{
+					FrameGains[Offset] = InAdvanceFrame(Frame + Offset);
+					FrameCoefficients[Offset] = InOutCoefficients;
+				}
+				Lanes.template ProcessFrames4<bApplyGain>(FrameCoefficients, FrameGains, InAudio, OutAudio, Frame);
+			}
+
+			Lanes.Store(InOutStates);
+			return Frame;
+		}
+
+		FORCEINLINE void ProcessLowPass(const FSVFCoefficients& InCoefficients, FSVFState& InOutState, const float* InSamples, float* OutSamples, int32 InNumSamples)
+		{
+			for (int32 i = 0; i < InNumSamples; ++i)
+			{
+				OutSamples[i] = ProcessLowPassSample(InCoefficients, InOutState, InSamples[i]);
+			}
+		}
+
+		//Moves the vactrol cell one sample towards InDrive and sets the filter cut off from its level, returns the cell gain
+		//InDarkOctaves is the cut off, in FCutOffTable octaves, that the filter closes down to when the cell is dark
+		FORCEINLINE float UpdateVactrolCell(const FVactrolTable& InVactrol, const FCutOffTable& InCutOffs, float InDarkOctaves, float InDrive, float& InOutLevel, FSVFCoefficients& InOutCoefficients)
+		{
+			InOutLevel += (InDrive - InOutLevel) * InVactrol.GetCoefficient(InDrive, InOutLevel);
+			InOutCoefficients.SetG(InCutOffs.GetG(InDarkOctaves + FVactrolTable::CutOffRangeOctaves * InOutLevel));
+
+			return FVactrolTable::GetGain(InOutLevel);
+		}
+
+		//One sample of the vactrol gate, the envelope lights the cell and the cell level sets both cut off and gain
+		FORCEINLINE float ProcessVactrolSample(const FVactrolTable& InVactrol, const FCutOffTable& InCutOffs, float InDarkOctaves, float InDrive, float& InOutLevel, FSVFCoefficients& InOutCoefficients, FSVFState& InOutState, float InSample)
+		{
+			const float Gain = UpdateVactrolCell(InVactrol, InCutOffs, InDarkOctaves, InDrive, InOutLevel, InOutCoefficients);
+
+			return ProcessLowPassSample(InOutCoefficients, InOutState, InSample) * Gain;
+		}
+
+		//Polyphase half-band FIR used to run the filter and gate above the graph rate
+		//Every other tap of a half-band filter is zero, so only NumSideTaps multiplies are needed per output sample
+		//Kaiser windowed sinc, flat to within 0.001 up to 0.2 of the oversampled rate and around -60dB from 0.3
+		class FHalfBandResampler
+		{
+		public:
+			static constexpr int32 NumSideTaps = 10;
+			//Delay of one up and down round trip, in samples at the lower rate
+			static constexpr int32 Latency = 2 * NumSideTaps - 1;
+
+			void Reset()
+			{
+				FMemory::Memzero(UpHistory, sizeof(UpHistory));
+				FMemory::Memzero(DownHistory, sizeof(DownHistory));
+				UpPosition = 0;
+				DownPosition = 0;
+			}
+
+			bool IsSilent() const
+			{
+				return GetPeak(UpHistory, UE_ARRAY_COUNT(UpHistory)) < SilenceThreshold && GetPeak(DownHistory, UE_ARRAY_COUNT(DownHistory)) < SilenceThreshold;
+			}
+
+			//Writes the two samples at twice the rate for one input sample, OutAligned lines up with an input sample
+			FORCEINLINE void Upsample(float InSample, float& OutAligned, float& OutMidpoint)
+			{
+				//The history is written twice so the newest UpLength samples are always contiguous
+				UpPosition = UpPosition + 1 == UpLength ? 0 : UpPosition + 1;
+				UpHistory[UpPosition] = InSample;
+				UpHistory[UpPosition + UpLength] = InSample;
+				const float* Window = UpHistory + UpPosition + 1;
+
+				float Sum = 0.0f;
+				for (int32 Tap = 0; Tap < NumSideTaps; ++Tap)
+				{
+					Sum += Coefficients[Tap] * (Window[NumSideTaps - 1 - Tap] + Window[NumSideTaps + Tap]);
+				}
+
+				//Zero stuffing halves the level, the doubled sum and the unscaled centre tap make up for it
+				OutAligned = Window[NumSideTaps - 1];
+				OutMidpoint = 2.0f * Sum;
+			}
+
+			//Takes two samples in the order Upsample wrote them and returns one at half the rate
+			FORCEINLINE float Downsample(float InAligned, float InMidpoint)
+			{
+				PushDown(InAligned);
+				PushDown(InMidpoint);
+				const float* Window = DownHistory + DownPosition + 1;
+
+				float Sum = 0.5f * Window[2 * NumSideTaps - 1];
+				for (int32 Tap = 0; Tap < NumSideTaps; ++Tap)
+				{
+					Sum += Coefficients[Tap] * (Window[2 * NumSideTaps - 2 - 2 * Tap] + Window[2 * NumSideTaps + 2 * Tap]);
+				}
+				return Sum;
+			}
+
+		private:
+			static constexpr int32 UpLength = 2 * NumSideTaps;
+			static constexpr int32 DownLength = 4 * NumSideTaps - 1;
+
+			//Non-zero taps either side of the 0.5 centre tap, normalised for unity gain at DC
+			static constexpr float Coefficients[NumSideTaps] =
+			{
+				3.162542858e-01f, -9.977147564e-02f, 5.353933804e-02f, -3.221441289e-02f, 1.976795654e-02f,
+				-1.184389251e-02f, 6.712068047e-03f, -3.473137320e-03f, 1.550197104e-03f, -5.209272026e-04f
+			};
+
+			FORCEINLINE void PushDown(float InSample)
+			{
+				DownPosition = DownPosition + 1 == DownLength ? 0 : DownPosition + 1;
+				DownHistory[DownPosition] = InSample;
+				DownHistory[DownPosition + DownLength] = InSample;
+			}
+
+			float UpHistory[2 * UpLength] = {};
+			float DownHistory[2 * DownLength] = {};
+			int32 UpPosition = 0;
+			int32 DownPosition = 0;
+		};
+
+		//2x or 4x oversampling from one or two cascaded half-band stages, a factor of 1 passes samples straight through
+		class FOversampler
+		{
+		public:
+			static constexpr int32 MaxFactor = 4;
+
+			//Anything other than 2 or 4 falls back to 1, changing the factor clears the history
+			void SetFactor(int32 InFactor)
+			{
+				Factor = (InFactor == 2 || InFactor == 4) ? InFactor : 1;
+				Reset();
+			}
+
+			int32 GetFactor() const { return Factor; }
+
+			void Reset()
+			{
+				Stages[0].Reset();
+				Stages[1].Reset();
+				Carry = 0.0f;
+			}
+
+			bool IsSilent() const
+			{
+				return Factor == 1 || (Stages[0].IsSilent() && (Factor == 2 || Stages[1].IsSilent()));
+			}
+
+			//Delay added by the round trip, in samples at the graph rate
+			int32 GetLatency() const
+			{
+				if (Factor == 4)
+				{
+					//The inner stage runs at 2x, plus the one sample Carry that keeps the outer stage aligned
+					return FHalfBandResampler::Latency + (FHalfBandResampler::Latency + 1) / 2;
+				}
+				return Factor == 2 ? FHalfBandResampler::Latency : 0;
+			}
+
+			//Writes GetFactor() samples at the oversampled rate
+			FORCEINLINE void Upsample(float InSample, float* OutSamples)
+			{
+				if (Factor == 4)
+				{
+					float Aligned;
+					float Midpoint;
+					Stages[0].Upsample(InSample, Aligned, Midpoint);
+					Stages[1].Upsample(Aligned, OutSamples[0], OutSamples[1]);
+					Stages[1].Upsample(Midpoint, OutSamples[2], OutSamples[3]);
+				}
+				else if (Factor == 2)
+				{
+					Stages[0].Upsample(InSample, OutSamples[0], OutSamples[1]);
+				}
+				else
+				{
+					OutSamples[0] = InSample;
+				}
+			}
+
+			//Reads GetFactor() samples at the oversampled rate and returns one at the graph rate
+			FORCEINLINE float Downsample(const float* InSamples)
+			{
+				if (Factor == 4)
+				{
+					const float First = Stages[1].Downsample(InSamples[0], InSamples[1]);
+					const float Second = Stages[1].Downsample(InSamples[2], InSamples[3]);
+
+					//The inner stage latency is odd at 2x, holding back one sample puts its aligned output first again
+					const float Output = Stages[0].Downsample(Carry, First);
+					Carry = Second;
+					return Output;
+				}
+				else if (Factor == 2)
+				{
+					return Stages[0].Downsample(InSamples[0], InSamples[1]);
+				}
+				return InSamples[0];
+			}
+
+		private:
+			FHalfBandResampler Stages[2];
+			int32 Factor = 1;
+			float Carry = 0.0f;
+		};
+
+		//Parabolic sine approximation with one refinement step, InPhase is in cycles [0, 1)
+		FORCEINLINE float FastSineCycles(float InPhase)
+		{
+			//sin(2 pi p) == -sin(pi x) for x = 2p - 1, approximated on [-1, 1)
+			const float X = 2.0f * InPhase - 1.0f;
+			const float Y = 4.0f * X * (1.0f - FMath::Abs(X));
+
+			return -(0.225f * (Y * FMath::Abs(Y) - Y) + Y);
+		}
+
+		//Polynomial log2, bit exact exponent plus a quartic on the mantissa, error around 2e-4
+		FORCEINLINE float FastLog2(float InValue)
+		{
+			uint32 Bits;
+			FMemory::Memcpy(&Bits, &InValue, sizeof(Bits));
+
+			const float Exponent = (float)((int32)((Bits >> 23) & 255) - 127);
+			Bits = (Bits & 0x007FFFFF) | 0x3F800000;
+
+			float Mantissa;
+			FMemory::Memcpy(&Mantissa, &Bits, sizeof(Mantissa));
+
+			const float X = Mantissa - 1.0f;
+			return Exponent + 0.00020318f + X * (1.4361078f + X * (-0.66954228f + X * (0.31224097f - 0.079158161f * X)));
+		}
+
+		//Polynomial exp2, the integer part goes straight into the exponent bits
+		FORCEINLINE float FastExp2(float InValue)
+		{
+			const float Clamped = FMath::Clamp(InValue, -126.0f, 126.0f);
+			const int32 Whole = FMath::FloorToInt(Clamped);
+			const float Fraction = Clamped - (float)Whole;
+
+			const uint32 Bits = (uint32)(Whole + 127) << 23;
+			float Scale;
+			FMemory::Memcpy(&Scale, &Bits, sizeof(Scale));
+
+			return Scale * (0.99981246f + Fraction * (0.69683624f + Fraction * (0.22412837f + Fraction * 0.079020413f)));
+		}
+
+		//Stand-in for FMath::Pow(InFraction, InExponent) on the envelope's [0, 1) fractions with positive exponents
+		FORCEINLINE float FastPowFraction(float InFraction, float InExponent)
+		{
+			return InFraction > 0.0f ? FMath::Min(1.0f, FastExp2(InExponent * FastLog2(InFraction))) : 0.0f;
+		}
+
+		//Four lane versions of the three functions above, same polynomials, so they agree with the scalar ones to within rounding
+		FORCEINLINE VectorRegister4Float VectorFastLog2(const VectorRegister4Float& InValue)
+		{
+			const VectorRegister4Int Bits = VectorCastFloatToInt(InValue);
+
+			const VectorRegister4Float Exponent = VectorSubtract(VectorIntToFloat(VectorIntAnd(VectorShiftRightImmLogical(Bits, 23), VectorIntSet1(255))), VectorSetFloat1(127.0f));
+			const VectorRegister4Float Mantissa = VectorCastIntToFloat(VectorIntOr(VectorIntAnd(Bits, VectorIntSet1(0x007FFFFF)), VectorIntSet1(0x3F800000)));
+
+			const VectorRegister4Float X = VectorSubtract(Mantissa, VectorOneFloat());
+			VectorRegister4Float Polynomial = VectorMultiplyAdd(X, VectorSetFloat1(-0.079158161f), VectorSetFloat1(0.31224097f));
+			Polynomial = VectorMultiplyAdd(X, Polynomial, VectorSetFloat1(-0.66954228f));
+			Polynomial = VectorMultiplyAdd(X, Polynomial, VectorSetFloat1(1.4361078f));
+			Polynomial = VectorMultiplyAdd(X, Polynomial, VectorSetFloat1(0.00020318f));
+
+			return VectorAdd(Exponent, Polynomial);
+		}
+
+		FORCEINLINE VectorRegister4Float VectorFastExp2(const VectorRegister4Float& InValue)
+		{
+			const VectorRegister4Float Clamped = VectorMin(VectorMax(InValue, VectorSetFloat1(-126.0f)), VectorSetFloat1(126.0f));
+			const VectorRegister4Float Whole = VectorFloor(Clamped);
+			const VectorRegister4Float Fraction = VectorSubtract(Clamped, Whole);
+
+			const VectorRegister4Int Bits = VectorShiftLeftImm(VectorIntAdd(VectorFloatToInt(Whole), VectorIntSet1(127)), 23);
+			const VectorRegister4Float Scale = VectorCastIntToFloat(Bits);
+
+			VectorRegister4Float Polynomial = VectorMultiplyAdd(Fraction, VectorSetFloat1(0.079020413f), VectorSetFloat1(0.22412837f));
+			Polynomial = VectorMultiplyAdd(Fraction, Polynomial, VectorSetFloat1(0.69683624f));
+			Polynomial = VectorMultiplyAdd(Fraction, Polynomial, VectorSetFloat1(0.99981246f));
+
+			return VectorMultiply(Scale, Polynomial);
+		}
+
+		FORCEINLINE VectorRegister4Float VectorFastPowFraction(const VectorRegister4Float& InFraction, const VectorRegister4Float& InExponent)
+		{
+			const VectorRegister4Float Power = VectorMin(VectorOneFloat(), VectorFastExp2(VectorMultiply(InExponent, VectorFastLog2(InFraction))));
+			return VectorSelect(VectorCompareGT(InFraction, VectorZeroFloat()), Power, VectorZeroFloat());
+		}
+	}
+}
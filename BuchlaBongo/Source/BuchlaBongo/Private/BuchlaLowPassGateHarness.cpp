@@ -0,0 +1,85 @@
+#include "BuchlaLowPassGateHarness.h"
+
+namespace Metasound
+{
+	FLowPassGateHarness::FLowPassGateHarness(float InSampleRate, int32 InNumFramesPerBlock, ELowPassGateMode InMode, int32 InNumInstances, int32 InGateId)
+		: Settings(FMath::RoundToInt(InSampleRate), InSampleRate / FMath::Max(1, InNumFramesPerBlock))
+		, Trigger(FTriggerWriteRef::CreateNew(Settings))
+		, AttackTime(FTimeWriteRef::CreateNew(FTime(0.01)))
+		, DecayTime(FTimeWriteRef::CreateNew(FTime(0.1)))
+		, AttackCurve(FFloatWriteRef::CreateNew(1.0f))
+		, DecayCurve(FFloatWriteRef::CreateNew(0.5f))
+		, AudioIn(FAudioBufferWriteRef::CreateNew(Settings))
+		, CutOff(FFloatWriteRef::CreateNew(1500.0f))
+		, Resonance(FFloatWriteRef::CreateNew(0.0f))
+		, Mode(FEnumLowPassGateModeWriteRef::CreateNew(InMode))
+		, CutOffModulation(FAudioBufferWriteRef::CreateNew(Settings))
+		, Oversampling(FEnumLowPassGateOversamplingWriteRef::CreateNew(ELowPassGateOversampling::None))
+		, ExcitationId(FInt32WriteRef::CreateNew(0))
+		, GateId(FInt32WriteRef::CreateNew(InGateId))
+	{
+		//Matches a graph with the Trigger connected and Cut Off Mod left open
+		for (int32 Instance = 0; Instance < InNumInstances; ++Instance)
+		{
+			TUniquePtr<FLowPassGateOperator>& Operator = Operators.Emplace_GetRef(MakeUnique<FLowPassGateOperator>(Settings, Trigger, AttackTime, DecayTime, AttackCurve, DecayCurve, { AudioIn }, CutOff, Resonance, Mode, CutOffModulation, Oversampling, ExcitationId, GateId, FFloatWriteRef::CreateNew(0.0f), false, true));
+			//Offline renders, benchmarks and regressions all want the gate as authored, whatever the budget is doing to the live gates
+			Operator->SetUsesCpuBudget(false);
+			Outputs.Add(Operator->GetOutputs().GetDataReadReference<FAudioBuffer>(TEXT("Out")));
+		}
+	}
+
+	void FLowPassGateHarness::RenderBlock()
+	{
+		for (TUniquePtr<FLowPassGateOperator>& Operator : Operators)
+		{
+			Operator->Execute();
+		}
+
+		Trigger->AdvanceBlock();
+	}
+
+	void FLowPassGateHarness::ApplyParams(const FLowPassGateHitParams& InParams)
+	{
+		//Inputs first, ResetState selects the kernel and the oversampling from them
+		*AttackTime = FTime(InParams.AttackTime);
+		*DecayTime = FTime(InParams.DecayTime);
+		*AttackCurve = InParams.AttackCurve;
+		*DecayCurve = InParams.DecayCurve;
+		*CutOff = InParams.CutOff;
+		*Resonance = InParams.Resonance;
+		*Mode = InParams.Mode;
+		*Oversampling = InParams.Oversampling;
+		Trigger->Reset();
+
+		for (TUniquePtr<FLowPassGateOperator>& Operator : Operators)
+		{
+			Operator->ResetState(Settings);
+		}
+	}
+
+	int32 FLowPassGateHarness::LoadInputBlock(TArrayView<const float> InSource, int32 InBlockStart)
+	{
+		const int32 NumFrames = Settings.GetNumFramesPerBlock();
+		float* Input = AudioIn->GetData();
+
+		const int32 NumSourceFrames = FMath::Clamp(InSource.Num() - InBlockStart, 0, NumFrames);
+		if (NumSourceFrames > 0)
+		{
+			FMemory::Memcpy(Input, InSource.GetData() + InBlockStart, sizeof(float) * NumSourceFrames);
+		}
+		FMemory::Memzero(Input + NumSourceFrames, sizeof(float) * (NumFrames - NumSourceFrames));
+
+		return NumSourceFrames;
+	}
+
+	void FLowPassGateHarness::FillInputWithNoise(uint32 InSeed)
+	{
+		uint32 Seed = InSeed;
+		float* Samples = AudioIn->GetData();
+		for (int32 i = 0; i < AudioIn->Num(); ++i)
+		{
+			Seed = Seed * 1664525u + 1013904223u;
+			Samples[i] = (float)(int32)Seed * (1.0f / 2147483648.0f);
+		}
+	}
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "BuchlaLowPassGate.h"
+#include "BuchlaLowPassGateHitCache.h"
+
+//Console tools that drive the gate outside of a MetaSound graph, compiled out of shipping builds
+//The harness itself is always built, the hit cache and the batch renderer run their offline passes through it
+#ifndef BUCHLABONGO_WITH_DEV_TOOLS
+#define BUCHLABONGO_WITH_DEV_TOOLS !UE_BUILD_SHIPPING
+#endif
+
+namespace Metasound
+{
+	//Owns one set of synthetic inputs and any number of gate operators reading them, no graph or frontend involved
+	//Inputs can be written freely between blocks, triggers are scheduled with Trigger->TriggerFrame() before RenderBlock()
+	class FLowPassGateHarness
+	{
+	public:
+		//A non-zero InGateId registers every instance with FLowPassGateControl
+		FLowPassGateHarness(float InSampleRate, int32 InNumFramesPerBlock, ELowPassGateMode InMode, int32 InNumInstances = 1, int32 InGateId = 0);
+
+		const FOperatorSettings Settings;
+
+		FTriggerWriteRef Trigger;
+		FTimeWriteRef AttackTime;
+		FTimeWriteRef DecayTime;
+		FFloatWriteRef AttackCurve;
+		FFloatWriteRef DecayCurve;
+		FAudioBufferWriteRef AudioIn;
+		FFloatWriteRef CutOff;
+		FFloatWriteRef Resonance;
+		FEnumLowPassGateModeWriteRef Mode;
+		FAudioBufferWriteRef CutOffModulation;
+		FEnumLowPassGateOversamplingWriteRef Oversampling;
+		FInt32WriteRef ExcitationId;
+		FInt32WriteRef GateId;
+
+		int32 GetNumFramesPerBlock() const { return Settings.GetNumFramesPerBlock(); }
+		int32 GetNumInstances() const { return Operators.Num(); }
+
+		//Executes every instance once, then consumes the scheduled triggers
+		void RenderBlock();
+
+		const FAudioBuffer& GetOutput(int32 InInstance) const { return *Outputs[InInstance]; }
+		const FLowPassGateOperator& GetOperator(int32 InInstance) const { return *Operators[InInstance]; }
+		FLowPassGateOperator& GetOperator(int32 InInstance) { return *Operators[InInstance]; }
+
+		//Writes every input InParams covers and puts the instances back to idle, the Excitation ID is left alone
+		void ApplyParams(const FLowPassGateHitParams& InParams);
+
+		//Copies the block of InSource starting at InBlockStart into AudioIn, past the end of InSource it reads as silence
+		//Returns how many frames came from InSource
+		int32 LoadInputBlock(TArrayView<const float> InSource, int32 InBlockStart);
+
+		//Fills the input with deterministic white noise so results are repeatable between runs
+		void FillInputWithNoise(uint32 InSeed);
+
+	private:
+		TArray<TUniquePtr<FLowPassGateOperator>> Operators;
+		TArray<FAudioBufferReadRef> Outputs;
+	};
+}
@@ -0,0 +1,231 @@
+#include "BuchlaLowPassGateHitCache.h"
+#include "BuchlaLowPassGateHarness.h"
+#include "BuchlaBongo.h"
+
+namespace Metasound
+{
+	namespace LowPassGateHitCache
+	{
+		//Rendered in blocks of this size, the result does not depend on it
+		constexpr int32 RenderBlockSize = 256;
+
+		//Covers the longest vactrol tail and filter ring after the envelope has finished
+		constexpr float MaxTailSeconds = 1.0f;
+	}
+
+	bool FLowPassGateHitParams::operator==(const FLowPassGateHitParams& InOther) const
+	{
+		//Exact comparisons, the gate builds its parameters from the same pin values the cache was filled with
+		return SampleRate == InOther.SampleRate
+			&& AttackTime == InOther.AttackTime
+			&& DecayTime == InOther.DecayTime
+			&& AttackCurve == InOther.AttackCurve
+			&& DecayCurve == InOther.DecayCurve
+			&& CutOff == InOther.CutOff
+			&& Resonance == InOther.Resonance
+			&& Mode == InOther.Mode
+			&& Oversampling == InOther.Oversampling
+			&& ExcitationId == InOther.ExcitationId;
+	}
+
+	uint32 GetTypeHash(const FLowPassGateHitParams& InParams)
+	{
+		uint32 Hash = ::GetTypeHash(InParams.ExcitationId);
+		Hash = HashCombine(Hash, ::GetTypeHash(InParams.SampleRate));
+		Hash = HashCombine(Hash, ::GetTypeHash(InParams.AttackTime));
+		Hash = HashCombine(Hash, ::GetTypeHash(InParams.DecayTime));
+		Hash = HashCombine(Hash, ::GetTypeHash(InParams.AttackCurve));
+		Hash = HashCombine(Hash, ::GetTypeHash(InParams.DecayCurve));
+		Hash = HashCombine(Hash, ::GetTypeHash(InParams.CutOff));
+		Hash = HashCombine(Hash, ::GetTypeHash(InParams.Resonance));
+		Hash = HashCombine(Hash, ::GetTypeHash((int32)InParams.Mode));
+		return HashCombine(Hash, ::GetTypeHash((int32)InParams.Oversampling));
+	}
+
+	FLowPassGateHitCache& FLowPassGateHitCache::Get()
+	{
+		static FLowPassGateHitCache Cache;
+		return Cache;
+	}
+
+	TArray<float> FLowPassGateHitCache::RenderHit(const FLowPassGateHitParams& InParams, TArrayView<const float> InExcitation)
+	{
+		using namespace LowPassGateHitCache;
+
+		//Excitation ID stays 0 so the render itself never plays back from the cache, Gate ID stays 0 so gameplay updates never reach it
+		FLowPassGateHarness Harness(InParams.SampleRate, RenderBlockSize, InParams.Mode);
+		Harness.ApplyParams(InParams);
+
+		const FDataReferenceCollection Outputs = Harness.GetOperator(0).GetOutputs();
+		const FTriggerReadRef OnDone = Outputs.GetDataReadReference<FTrigger>(TEXT("On Done"));
+		const FAudioBuffer& AudioOut = Harness.GetOutput(0);
+
+		const int32 NumFrames = Harness.GetNumFramesPerBlock();
+		const int32 MaxFrames = InExcitation.Num() + FMath::CeilToInt((InParams.AttackTime + InParams.DecayTime + MaxTailSeconds) * InParams.SampleRate);
+
+		TArray<float> Rendered;
+		Rendered.Reserve(MaxFrames + NumFrames);
+
+		//LowPass has no envelope to finish, the hit is over once the excitation has rung out
+		bool bIsEnvelopeDone = InParams.Mode == ELowPassGateMode::LowPass;
+		Harness.Trigger->TriggerFrame(0);
+
+		for (int32 BlockStart = 0; BlockStart < MaxFrames; BlockStart += NumFrames)
+		{
+			const int32 NumExcitationFrames = Harness.LoadInputBlock(InExcitation, BlockStart);
+			Harness.RenderBlock();
+
+			Rendered.Append(AudioOut.GetData(), NumFrames);
+			bIsEnvelopeDone |= OnDone->IsTriggeredInBlock();
+
+			if (bIsEnvelopeDone && NumExcitationFrames < NumFrames && LowPassGateDSP::GetPeak(AudioOut.GetData(), NumFrames) < LowPassGateDSP::SilenceThreshold)
+			{
+				break;
+			}
+		}
+
+		//The silent tail is dropped, playback simply stops where the hit became inaudible
+		int32 NumRendered = Rendered.Num();
+		while (NumRendered > 0 && FMath::Abs(Rendered[NumRendered - 1]) < LowPassGateDSP::SilenceThreshold)
+		{
+			--NumRendered;
+		}
+		Rendered.SetNum(NumRendered);
+		Rendered.Shrink();
+
+		return Rendered;
+	}
+
+	FLowPassGateHitRef FLowPassGateHitCache::Prerender(const FLowPassGateHitParams& InParams, TArrayView<const float> InExcitation)
+	{
+		if (InParams.ExcitationId == 0)
+		{
+			UE_LOG(LogBuchlaBongo, Warning, TEXT("Excitation ID 0 turns hit playback off, the hit will never be played back"));
+		}
+
+		FLowPassGateHitRef Hit = MakeShared<const TArray<float>, ESPMode::ThreadSafe>(RenderHit(InParams, InExcitation));
+
+		FScopeLock Lock(&WriteCritSection);
+
+		TUniquePtr<FHitMap> Hits = CopySnapshot();
+		if (const FLowPassGateHitRef* Replaced = Hits->Find(InParams))
+		{
+			RetiredHits.Add(*Replaced);
+		}
+		Hits->Add(InParams, Hit);
+		Publish(MoveTemp(Hits));
+
+		return Hit;
+	}
+
+	FLowPassGateHitRef FLowPassGateHitCache::Find(const FLowPassGateHitParams& InParams) const
+	{
+		//Counted before the snapshot is loaded, a writer that sees no readers after replacing it knows nobody can still hold it
+		NumReaders.fetch_add(1);
+
+		const FHitMap* Hits = Snapshot.load();
+		const FLowPassGateHitRef* Hit = Hits ? Hits->Find(InParams) : nullptr;
+		FLowPassGateHitRef Result = Hit ? *Hit : FLowPassGateHitRef();
+
+		NumReaders.fetch_sub(1);
+
+		return Result;
+	}
+
+	void FLowPassGateHitCache::Remove(const FLowPassGateHitParams& InParams)
+	{
+		FScopeLock Lock(&WriteCritSection);
+
+		if (!Published.IsValid() || !Published->Contains(InParams))
+		{
+			return;
+		}
+
+		TUniquePtr<FHitMap> Hits = CopySnapshot();
+		FLowPassGateHitRef Removed;
+		Hits->RemoveAndCopyValue(InParams, Removed);
+		RetiredHits.Add(MoveTemp(Removed));
+		Publish(MoveTemp(Hits));
+	}
+
+	void FLowPassGateHitCache::Empty()
+	{
+		FScopeLock Lock(&WriteCritSection);
+
+		if (!Published.IsValid() || Published->Num() == 0)
+		{
+			return;
+		}
+
+		for (const TPair<FLowPassGateHitParams, FLowPassGateHitRef>& Hit : *Published)
+		{
+			RetiredHits.Add(Hit.Value);
+		}
+		Publish(MakeUnique<FHitMap>());
+	}
+
+	void FLowPassGateHitCache::CollectRetired()
+	{
+		FScopeLock Lock(&WriteCritSection);
+		CollectRetiredLocked();
+	}
+
+	TUniquePtr<FLowPassGateHitCache::FHitMap> FLowPassGateHitCache::CopySnapshot() const
+	{
+		return Published.IsValid() ? MakeUnique<FHitMap>(*Published) : MakeUnique<FHitMap>();
+	}
+
+	void FLowPassGateHitCache::Publish(TUniquePtr<FHitMap> InHits)
+	{
+		Snapshot.store(InHits.Get());
+
+		if (Published.IsValid())
+		{
+			RetiredSnapshots.Add(MoveTemp(Published));
+		}
+		Published = MoveTemp(InHits);
+
+		CollectRetiredLocked();
+	}
+
+	void FLowPassGateHitCache::CollectRetiredLocked()
+	{
+		//A reader that arrives after this load gets the new snapshot, one still inside Find() keeps the count above 0
+		if (RetiredSnapshots.Num() > 0 && NumReaders.load() == 0)
+		{
+			RetiredSnapshots.Empty();
+		}
+
+		//With the snapshots gone nothing can hand out a retired hit again, the last reference left is ours once every gate has let go
+		if (RetiredSnapshots.Num() == 0)
+		{
+			RetiredHits.RemoveAllSwap([](const FLowPassGateHitRef& InHit)
+			{
+				return InHit.GetSharedReferenceCount() == 1;
+			});
+		}
+	}
+
+	int32 FLowPassGateHitCache::Num() const
+	{
+		FScopeLock Lock(&WriteCritSection);
+		return Published.IsValid() ? Published->Num() : 0;
+	}
+
+	SIZE_T FLowPassGateHitCache::GetAllocatedSize() const
+	{
+		FScopeLock Lock(&WriteCritSection);
+
+		if (!Published.IsValid())
+		{
+			return 0;
+		}
+
+		SIZE_T Size = Published->GetAllocatedSize();
+		for (const TPair<FLowPassGateHitParams, FLowPassGateHitRef>& Hit : *Published)
+		{
+			Size += Hit.Value->GetAllocatedSize();
+		}
+		return Size;
+	}
+}
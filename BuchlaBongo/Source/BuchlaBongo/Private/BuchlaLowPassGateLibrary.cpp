@@ -0,0 +1,102 @@
+#include "BuchlaLowPassGateLibrary.h"
+#include "BuchlaLowPassGateControl.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(BuchlaLowPassGateLibrary)
+
+namespace BuchlaLowPassGateLibrary
+{
+	using namespace Metasound;
+
+	//The Blueprint enum is cast straight to the MetaSound one, so the two have to stay in step
+	static_assert((int32)EBuchlaLowPassGateMode::LowPass == (int32)ELowPassGateMode::LowPass, "EBuchlaLowPassGateMode must mirror ELowPassGateMode");
+	static_assert((int32)EBuchlaLowPassGateMode::VCA == (int32)ELowPassGateMode::VCA, "EBuchlaLowPassGateMode must mirror ELowPassGateMode");
+	static_assert((int32)EBuchlaLowPassGateMode::Both == (int32)ELowPassGateMode::Both, "EBuchlaLowPassGateMode must mirror ELowPassGateMode");
+	static_assert((int32)EBuchlaLowPassGateMode::Vactrol == (int32)ELowPassGateMode::Vactrol, "EBuchlaLowPassGateMode must mirror ELowPassGateMode");
+	static_assert((int32)EBuchlaLowPassGateMode::Follower == (int32)ELowPassGateMode::Follower, "EBuchlaLowPassGateMode must mirror ELowPassGateMode");
+
+	//Most gameplay batches are small, so converting them does not touch the heap
+	using FUpdateArray = TArray<FLowPassGateUpdate, TInlineAllocator<64>>;
+
+	static FLowPassGateUpdate ToGateUpdate(const FBuchlaLowPassGateUpdate& InUpdate)
+	{
+		FLowPassGateUpdate Update;
+		Update.GateId = InUpdate.GateId;
+
+		if (InUpdate.bSetCutOff)
+		{
+			Update.Fields |= ELowPassGateUpdateFields::CutOff;
+			Update.CutOff = InUpdate.CutOff;
+		}
+		if (InUpdate.bSetMode)
+		{
+			Update.Fields |= ELowPassGateUpdateFields::Mode;
+			Update.Mode = (ELowPassGateMode)InUpdate.Mode;
+		}
+		if (InUpdate.bSetAttackTime)
+		{
+			Update.Fields |= ELowPassGateUpdateFields::AttackTime;
+			Update.AttackTime = InUpdate.AttackTime;
+		}
+		if (InUpdate.bSetDecayTime)
+		{
+			Update.Fields |= ELowPassGateUpdateFields::DecayTime;
+			Update.DecayTime = InUpdate.DecayTime;
+		}
+		if (InUpdate.bTrigger)
+		{
+			Update.Fields |= ELowPassGateUpdateFields::Trigger;
+			Update.TriggerFrame = FMath::Max(0, InUpdate.TriggerFrame);
+		}
+
+		return Update;
+	}
+}
+
+void UBuchlaLowPassGateLibrary::SendGateUpdates(const TArray<FBuchlaLowPassGateUpdate>& Updates)
+{
+	using namespace BuchlaLowPassGateLibrary;
+
+	FUpdateArray GateUpdates;
+	GateUpdates.Reserve(Updates.Num());
+	for (const FBuchlaLowPassGateUpdate& Update : Updates)
+	{
+		GateUpdates.Add(ToGateUpdate(Update));
+	}
+
+	Metasound::FLowPassGateControl::Get().Send(GateUpdates);
+}
+
+void UBuchlaLowPassGateLibrary::TriggerGates(const TArray<int32>& GateIds)
+{
+	using namespace BuchlaLowPassGateLibrary;
+
+	FUpdateArray GateUpdates;
+	GateUpdates.Reserve(GateIds.Num());
+	for (int32 GateId : GateIds)
+	{
+		FLowPassGateUpdate& Update = GateUpdates.AddDefaulted_GetRef();
+		Update.GateId = GateId;
+		Update.Fields = ELowPassGateUpdateFields::Trigger;
+	}
+
+	Metasound::FLowPassGateControl::Get().Send(GateUpdates);
+}
+
+void UBuchlaLowPassGateLibrary::SetGateCutOff(int32 GateId, float CutOff)
+{
+	Metasound::FLowPassGateUpdate Update;
+	Update.GateId = GateId;
+	Update.Fields = Metasound::ELowPassGateUpdateFields::CutOff;
+	Update.CutOff = CutOff;
+
+	Metasound::FLowPassGateControl::Get().Send(Update);
+}
+
+void UBuchlaLowPassGateLibrary::ClearGateOverrides(int32 GateId)
+{
+	Metasound::FLowPassGateUpdate Update;
+	Update.GateId = GateId;
+	Update.Fields = Metasound::ELowPassGateUpdateFields::ClearOverrides;
+
+	Metasound::FLowPassGateControl::Get().Send(Update);
+}
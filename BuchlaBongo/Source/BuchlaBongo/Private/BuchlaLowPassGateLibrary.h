@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "BuchlaLowPassGateLibrary.generated.h"
+
+//Mirrors ELowPassGateMode, which is a MetaSound enum and cannot be used from Blueprint directly
+UENUM(BlueprintType)
+enum class EBuchlaLowPassGateMode : uint8
+{
+	LowPass,
+	VCA,
+	Both,
+	Vactrol,
+	Follower
+};
+
+//One batched update for every Buchla Low Pass Gate whose Gate ID input matches, only the fields flagged true are applied
+USTRUCT(BlueprintType)
+struct BUCHLABONGO_API FBuchlaLowPassGateUpdate
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Buchla Low Pass Gate")
+	int32 GateId = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Buchla Low Pass Gate")
+	bool bSetCutOff = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Buchla Low Pass Gate", meta = (EditCondition = "bSetCutOff"))
+	float CutOff = 1500.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Buchla Low Pass Gate")
+	bool bSetMode = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Buchla Low Pass Gate", meta = (EditCondition = "bSetMode"))
+	EBuchlaLowPassGateMode Mode = EBuchlaLowPassGateMode::LowPass;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Buchla Low Pass Gate")
+	bool bSetAttackTime = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Buchla Low Pass Gate", meta = (EditCondition = "bSetAttackTime"))
+	float AttackTime = 0.01f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Buchla Low Pass Gate")
+	bool bSetDecayTime = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Buchla Low Pass Gate", meta = (EditCondition = "bSetDecayTime"))
+	float DecayTime = 0.1f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Buchla Low Pass Gate")
+	bool bTrigger = false;
+
+	//Frame within the next rendered block the trigger lands on
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Buchla Low Pass Gate", meta = (EditCondition = "bTrigger", ClampMin = "0"))
+	int32 TriggerFrame = 0;
+};
+
+//Drives Buchla Low Pass Gates straight from gameplay, bypassing MetaSound parameter transmission
+//Updates go into one lock-free queue per gate and are applied at the start of the gate's next block
+UCLASS()
+class BUCHLABONGO_API UBuchlaLowPassGateLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "Audio|Buchla Low Pass Gate")
+	static void SendGateUpdates(const TArray<FBuchlaLowPassGateUpdate>& Updates);
+
+	UFUNCTION(BlueprintCallable, Category = "Audio|Buchla Low Pass Gate")
+	static void TriggerGates(const TArray<int32>& GateIds);
+
+	UFUNCTION(BlueprintCallable, Category = "Audio|Buchla Low Pass Gate")
+	static void SetGateCutOff(int32 GateId, float CutOff);
+
+	//Hands Cut Off, Mode, Attack Time and Decay Time back to the gate's pins, until the next update sets them again
+	UFUNCTION(BlueprintCallable, Category = "Audio|Buchla Low Pass Gate")
+	static void ClearGateOverrides(int32 GateId);
+};
@@ -0,0 +1,255 @@
+#include "BuchlaLowPassGateHarness.h"
+
+#if BUCHLABONGO_WITH_DEV_TOOLS
+
+#include "BuchlaBongo.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/AutomationTest.h"
+#include "Interfaces/IPluginManager.h"
+
+namespace Metasound
+{
+	namespace LowPassGateRegression
+	{
+		static const TCHAR* ModeNames[] = { TEXT("LowPass"), TEXT("VCA"), TEXT("Both"), TEXT("Vactrol"), TEXT("Follower") };
+		static const ELowPassGateMode Modes[] = { ELowPassGateMode::LowPass, ELowPassGateMode::VCA, ELowPassGateMode::Both, ELowPassGateMode::Vactrol, ELowPassGateMode::Follower };
+
+		//Golden buffers are rendered at this rate and block size
+		constexpr float GoldenSampleRate = 48000.0f;
+		constexpr int32 GoldenBlockSize = 256;
+
+		//Block sizes compared against the smallest one, 480 checks a size that is not a power of two
+		static const int32 InvarianceBlockSizes[] = { 64, 128, 480, 1024, 2048 };
+
+		//Largest per-sample difference accepted, well below anything audible
+		constexpr float Tolerance = 1.0e-4f;
+
+		//A fixed pattern of hits, the input is a 220Hz sine only while a hit is sounding so sleep has nothing to discard
+		struct FScenario
+		{
+			const TCHAR* Name;
+			TArray<int32> TriggerFrames;
+			int32 NumFrames;
+		};
+
+		static TArray<FScenario> GetScenarios()
+		{
+			return {
+				{ TEXT("SingleHit"), { 100 }, 24000 },
+				{ TEXT("Retrigger"), { 100, 2000, 3100, 9000 }, 24000 },
+				{ TEXT("OffBlockHits"), { 37, 4133, 12007, 19999 }, 36000 },
+			};
+		}
+
+		static TArray<float> RenderScenario(const FScenario& InScenario, ELowPassGateMode InMode, float InSampleRate, int32 InBlockSize)
+		{
+			FLowPassGateHarness Harness(InSampleRate, InBlockSize, InMode);
+
+			const int32 NumFrames = Harness.GetNumFramesPerBlock();
+			//Attack plus decay of the harness defaults, with a little extra for the filter to settle
+			const int32 HitLength = FMath::CeilToInt(0.12f * InSampleRate);
+			const float PhaseIncrement = 220.0f / InSampleRate;
+
+			TArray<float> Rendered;
+			Rendered.Reserve(InScenario.NumFrames + NumFrames);
+
+			int32 NextTrigger = 0;
+			int32 InputEndFrame = 0;
+
+			for (int32 BlockStart = 0; BlockStart < InScenario.NumFrames; BlockStart += NumFrames)
+			{
+				float* Input = Harness.AudioIn->GetData();
+				for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+				{
+					const int32 AbsoluteFrame = BlockStart + Frame;
+					if (NextTrigger < InScenario.TriggerFrames.Num() && InScenario.TriggerFrames[NextTrigger] == AbsoluteFrame)
+					{
+						Harness.Trigger->TriggerFrame(Frame);
+						InputEndFrame = AbsoluteFrame + HitLength;
+						++NextTrigger;
+					}
+
+					const bool bIsSounding = NextTrigger > 0 && AbsoluteFrame < InputEndFrame;
+					Input[Frame] = bIsSounding ? 0.5f * FMath::Sin(2.0f * PI * FMath::Fractional(PhaseIncrement * AbsoluteFrame)) : 0.0f;
+				}
+
+				Harness.RenderBlock();
+				Rendered.Append(Harness.GetOutput(0).GetData(), NumFrames);
+			}
+
+			Rendered.SetNum(InScenario.NumFrames);
+			return Rendered;
+		}
+
+		static float GetMaxDifference(const TArray<float>& InA, const TArray<float>& InB, int32& OutFrame)
+		{
+			OutFrame = INDEX_NONE;
+			if (InA.Num() != InB.Num())
+			{
+				return TNumericLimits<float>::Max();
+			}
+
+			float MaxDifference = 0.0f;
+			for (int32 i = 0; i < InA.Num(); ++i)
+			{
+				const float Difference = FMath::Abs(InA[i] - InB[i]);
+				if (Difference > MaxDifference)
+				{
+					MaxDifference = Difference;
+					OutFrame = i;
+				}
+			}
+			return MaxDifference;
+		}
+
+		//Goldens live with the plugin so they are versioned with the code that renders them
+		static FString GetGoldenPath(const FScenario& InScenario, int32 InModeIndex)
+		{
+			const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("BuchlaBongo"));
+			check(Plugin.IsValid());
+			return Plugin->GetBaseDir() / TEXT("Resources") / TEXT("Golden") / FString::Printf(TEXT("%s_%s.raw"), InScenario.Name, ModeNames[InModeIndex]);
+		}
+
+		//Empty when the render matches the golden, otherwise what went wrong, a missing golden is a failure
+		static FString CheckGolden(const FScenario& InScenario, int32 InModeIndex)
+		{
+			const TArray<float> Rendered = RenderScenario(InScenario, Modes[InModeIndex], GoldenSampleRate, GoldenBlockSize);
+			const FString Path = GetGoldenPath(InScenario, InModeIndex);
+
+			TArray<uint8> Bytes;
+			if (!FFileHelper::LoadFileToArray(Bytes, *Path, FILEREAD_Silent))
+			{
+				return FString::Printf(TEXT("No golden for %s %s at %s, run BuchlaBongo.Regression Record on a known good build and commit the result"), InScenario.Name, ModeNames[InModeIndex], *Path);
+			}
+
+			TArray<float> Golden;
+			Golden.SetNumUninitialized(Bytes.Num() / sizeof(float));
+			FMemory::Memcpy(Golden.GetData(), Bytes.GetData(), Golden.Num() * sizeof(float));
+
+			int32 Frame = INDEX_NONE;
+			const float Difference = GetMaxDifference(Golden, Rendered, Frame);
+			if (Difference > Tolerance)
+			{
+				return FString::Printf(TEXT("Golden mismatch %s %s: max difference %g at frame %d"), InScenario.Name, ModeNames[InModeIndex], Difference, Frame);
+			}
+
+			return FString();
+		}
+
+		static bool RecordGolden(const FScenario& InScenario, int32 InModeIndex)
+		{
+			const TArray<float> Rendered = RenderScenario(InScenario, Modes[InModeIndex], GoldenSampleRate, GoldenBlockSize);
+			const FString Path = GetGoldenPath(InScenario, InModeIndex);
+
+			const TArrayView<const uint8> Bytes((const uint8*)Rendered.GetData(), Rendered.Num() * sizeof(float));
+			if (!FFileHelper::SaveArrayToFile(Bytes, *Path))
+			{
+				UE_LOG(LogBuchlaBongo, Error, TEXT("Could not write golden %s"), *Path);
+				return false;
+			}
+			UE_LOG(LogBuchlaBongo, Display, TEXT("Recorded %s"), *Path);
+			return true;
+		}
+
+		//Only triggers change within a scenario, parameter ramps are one block long by design and are not covered
+		//Empty when every block size matches the smallest one, otherwise one line per block size that does not
+		static FString CheckBlockSizeInvariance(const FScenario& InScenario, int32 InModeIndex)
+		{
+			const TArray<float> Reference = RenderScenario(InScenario, Modes[InModeIndex], GoldenSampleRate, InvarianceBlockSizes[0]);
+
+			FString Errors;
+			for (int32 SizeIndex = 1; SizeIndex < UE_ARRAY_COUNT(InvarianceBlockSizes); ++SizeIndex)
+			{
+				const TArray<float> Rendered = RenderScenario(InScenario, Modes[InModeIndex], GoldenSampleRate, InvarianceBlockSizes[SizeIndex]);
+
+				int32 Frame = INDEX_NONE;
+				const float Difference = GetMaxDifference(Reference, Rendered, Frame);
+				if (Difference > Tolerance)
+				{
+					Errors += FString::Printf(TEXT("%sBlock size %d differs from %d in %s %s: max difference %g at frame %d"), Errors.IsEmpty() ? TEXT("") : LINE_TERMINATOR, InvarianceBlockSizes[SizeIndex], InvarianceBlockSizes[0], InScenario.Name, ModeNames[InModeIndex], Difference, Frame);
+				}
+			}
+			return Errors;
+		}
+
+		void Run(const TArray<FString>& InArgs)
+		{
+			const bool bRecord = InArgs.Num() > 0 && InArgs[0].Equals(TEXT("Record"), ESearchCase::IgnoreCase);
+
+			int32 NumFailed = 0;
+			int32 NumChecks = 0;
+
+			for (const FScenario& Scenario : GetScenarios())
+			{
+				for (int32 ModeIndex = 0; ModeIndex < UE_ARRAY_COUNT(Modes); ++ModeIndex)
+				{
+					FString Errors[2];
+					if (bRecord)
+					{
+						NumFailed += RecordGolden(Scenario, ModeIndex) ? 0 : 1;
+					}
+					else
+					{
+						Errors[0] = CheckGolden(Scenario, ModeIndex);
+					}
+					Errors[1] = CheckBlockSizeInvariance(Scenario, ModeIndex);
+					NumChecks += 2;
+
+					for (const FString& Error : Errors)
+					{
+						if (!Error.IsEmpty())
+						{
+							UE_LOG(LogBuchlaBongo, Error, TEXT("%s"), *Error);
+							++NumFailed;
+						}
+					}
+				}
+			}
+
+			if (NumFailed > 0)
+			{
+				UE_LOG(LogBuchlaBongo, Error, TEXT("Buchla Low Pass Gate regression: %d of %d checks failed"), NumFailed, NumChecks);
+			}
+			else
+			{
+				UE_LOG(LogBuchlaBongo, Display, TEXT("Buchla Low Pass Gate regression: all %d checks passed"), NumChecks);
+			}
+		}
+
+		static FAutoConsoleCommand RegressionCommand(
+			TEXT("BuchlaBongo.Regression"),
+			TEXT("Renders fixed trigger scenarios through every Buchla Low Pass Gate mode, compares them with the golden buffers in the plugin's Resources/Golden and checks the output does not change with block size. Pass Record to rewrite the golden buffers."),
+			FConsoleCommandWithArgsDelegate::CreateStatic(&Run));
+	}
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+//No goldens are committed yet, so only the block size check runs as a test, BuchlaBongo.Regression compares against goldens recorded locally
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBuchlaLowPassGateBlockSizeTest, "BuchlaBongo.LowPassGate.BlockSizeInvariance", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FBuchlaLowPassGateBlockSizeTest::RunTest(const FString& Parameters)
+{
+	using namespace Metasound::LowPassGateRegression;
+
+	for (const FScenario& Scenario : GetScenarios())
+	{
+		for (int32 ModeIndex = 0; ModeIndex < UE_ARRAY_COUNT(Modes); ++ModeIndex)
+		{
+			const FString Error = CheckBlockSizeInvariance(Scenario, ModeIndex);
+			if (!Error.IsEmpty())
+			{
+				AddError(Error);
+			}
+		}
+	}
+
+	return !HasAnyErrors();
+}
+
+#endif
+
+#endif
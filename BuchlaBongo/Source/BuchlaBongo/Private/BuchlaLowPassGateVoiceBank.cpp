@@ -0,0 +1,551 @@
+#include "BuchlaLowPassGateVoiceBank.h"
+#include "Internationalization/Text.h"
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundNodeRegistrationMacro.h"
+#include "MetasoundParamHelper.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundStandardNodesNames.h"
+#include "MetasoundTrigger.h"
+#include "MetasoundTime.h"
+#include "MetasoundAudioBuffer.h"
+#include "MetasoundStandardNodesCategories.h"
+#include "MetasoundFacade.h"
+#include "BuchlaEnvelope.h"
+#include "BuchlaLowPassGateDSP.h"
+#include "BuchlaLowPassGateBudget.h"
+#include "BuchlaBongoStats.h"
+#include "BuchlaBongoCVars.h"
+#include "Math/VectorRegister.h"
+#include "Misc/ScopeExit.h"
+
+#define LOCTEXT_NAMESPACE "BuchlaBongo_LPGVoiceBank"
+
+namespace Metasound
+{
+	namespace LowPassGateVoiceBank
+	{
+		METASOUND_PARAM(InputTrigger, "Trigger", "Starts a voice, stealing the quietest one when every voice is sounding");
+		METASOUND_PARAM(InputAttackTime, "Attack Time", "The attack time of the envelope");
+		METASOUND_PARAM(InputDecayTime, "Decay Time", "The decay time of the envelope");
+		METASOUND_PARAM(InputAttackCurve, "Attack Curve", "1.0 = linear growth, <1.0 = logorithmic growth, >1.0 = exponential growth");
+		METASOUND_PARAM(InputDecayCurve, "Decay Curve", "1.0 = linear decay, <1.0 = exponential decay, >1.0 = logorithmic decay");
+		METASOUND_PARAM(InputAudio, "In", "Audio input, shared by every voice");
+		METASOUND_PARAM(InputCutOff, "Cut Off", "Cut off frequency, captured by each voice when it is triggered");
+
+		METASOUND_PARAM(OutputOnDone, "On Done", "Triggers when any voice finishes");
+		METASOUND_PARAM(OutputActiveVoices, "Active Voices", "Number of voices currently sounding");
+		METASOUND_PARAM(OutputAudio, "Out", "Sum of all voices");
+	}
+
+	template<int32 NumVoices>
+	const FNodeClassMetadata& TLowPassGateVoiceBankOperator<NumVoices>::GetNodeInfo()
+	{
+		auto CreateNodeClassMetadata = []()->FNodeClassMetadata
+		{
+			FNodeClassMetadata Info;
+			Info.ClassName = { FName("BuchlaBongo"), TEXT("Buchla LPG Voice Bank"), FName(*FString::Printf(TEXT("%d Voices"), NumVoices)) };
+			Info.MajorVersion = 1;
+			Info.MinorVersion = 0;
+			Info.DisplayName = METASOUND_LOCTEXT_FORMAT("VoiceBankDisplayName", "Buchla LPG Voice Bank ({0} Voices)", NumVoices);
+			Info.Description = METASOUND_LOCTEXT("VoiceBankDescription", "Polyphonic low pass gate, each trigger starts its own filtered and gated voice");
+			Info.Author = TEXT("Declan Shields");
+			Info.DefaultInterface = GetVertexInterface();
+			Info.CategoryHierarchy.Emplace(NodeCategories::Filters);
+
+			return Info;
+		};
+
+		static const FNodeClassMetadata Info = CreateNodeClassMetadata();
+
+		return Info;
+	}
+
+	template<int32 NumVoices>
+	const FVertexInterface& TLowPassGateVoiceBankOperator<NumVoices>::GetVertexInterface()
+	{
+		using namespace LowPassGateVoiceBank;
+
+		static const FVertexInterface Interface(
+			FInputVertexInterface(
+				TInputDataVertex<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputTrigger)),
+				TInputDataVertex<FTime>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputAttackTime), 0.01f),
+				TInputDataVertex<FTime>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputDecayTime), 0.1f),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputAttackCurve), 1.0f),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputDecayCurve), 0.5f),
+				TInputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputAudio)),
+				TInputDataVertex<float>(METASOUND_GET_PARAM_NAME_AND_METADATA(InputCutOff), 1500.0f)
+			),
+			FOutputVertexInterface(
+				TOutputDataVertex<FTrigger>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputOnDone)),
+				TOutputDataVertex<int32>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputActiveVoices)),
+				TOutputDataVertex<FAudioBuffer>(METASOUND_GET_PARAM_NAME_AND_METADATA(OutputAudio))
+			)
+		);
+
+		return Interface;
+	}
+
+	template<int32 NumVoices>
+	TUniquePtr<IOperator> TLowPassGateVoiceBankOperator<NumVoices>::CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors)
+	{
+		using namespace LowPassGateVoiceBank;
+
+		const FInputVertexInterface& InputInterface = GetVertexInterface().GetInputInterface();
+
+		FTriggerReadRef TriggerIn = InParams.InputDataReferences.GetDataReadReferenceOrConstruct<FTrigger>(METASOUND_GET_PARAM_NAME(InputTrigger), InParams.OperatorSettings);
+		FTimeReadRef AttackTime = InParams.InputDataReferences.GetDataReadReferenceOrConstructWithVertexDefault<FTime>(InputInterface, METASOUND_GET_PARAM_NAME(InputAttackTime), InParams.OperatorSettings);
+		FTimeReadRef DecayTime = InParams.InputDataReferences.GetDataReadReferenceOrConstructWithVertexDefault<FTime>(InputInterface, METASOUND_GET_PARAM_NAME(InputDecayTime), InParams.OperatorSettings);
+		FFloatReadRef AttackCurveFactor = InParams.InputDataReferences.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InputAttackCurve), InParams.OperatorSettings);
+		FFloatReadRef DecayCurveFactor = InParams.InputDataReferences.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InputDecayCurve), InParams.OperatorSettings);
+		FAudioBufferReadRef AudioIn = InParams.InputDataReferences.GetDataReadReferenceOrConstruct<FAudioBuffer>(METASOUND_GET_PARAM_NAME(InputAudio), InParams.OperatorSettings);
+		FFloatReadRef CutOff = InParams.InputDataReferences.GetDataReadReferenceOrConstructWithVertexDefault<float>(InputInterface, METASOUND_GET_PARAM_NAME(InputCutOff), InParams.OperatorSettings);
+
+		return MakeUnique<TLowPassGateVoiceBankOperator<NumVoices>>(InParams.OperatorSettings, TriggerIn, AttackTime, DecayTime, AttackCurveFactor, DecayCurveFactor, AudioIn, CutOff);
+	}
+
+	template<int32 NumVoices>
+	TLowPassGateVoiceBankOperator<NumVoices>::TLowPassGateVoiceBankOperator(const FOperatorSettings& InSettings,
+		const FTriggerReadRef& InTriggerIn,
+		const FTimeReadRef& InAttackTime,
+		const FTimeReadRef& InDecayTime,
+		const FFloatReadRef& InAttackCurveFactor,
+		const FFloatReadRef& InDecayCurveFactor,
+		const FAudioBufferReadRef& InAudioInput,
+		const FFloatReadRef& InCutOff) : TriggerAttackIn(InTriggerIn)
+		, AttackTime(InAttackTime)
+		, DecayTime(InDecayTime)
+		, AttackCurveFactor(InAttackCurveFactor)
+		, DecayCurveFactor(InDecayCurveFactor)
+		, AudioInput(InAudioInput)
+		, CutOffFrequency(InCutOff)
+		, OnDone(TDataWriteReferenceFactory<FTrigger>::CreateAny(InSettings))
+		, ActiveVoices(TDataWriteReferenceFactory<int32>::CreateAny(InSettings))
+		, AudioOutput(FAudioBufferWriteRef::CreateNew(InSettings))
+	{
+		EnvelopeFrames.SetNumZeroed(InSettings.GetNumFramesPerBlock() * NumVoices);
+
+		//Each voice of a lane group can finish at most once per trigger range
+		FinishedFrames.Reserve(4);
+
+		//Counted as active until ResetState decides otherwise
+		INC_DWORD_STAT(STAT_BuchlaBongo_ActiveGates);
+		ResetState(InSettings);
+	}
+
+	template<int32 NumVoices>
+	TLowPassGateVoiceBankOperator<NumVoices>::~TLowPassGateVoiceBankOperator()
+	{
+		if (bIsSleeping)
+		{
+			DEC_DWORD_STAT(STAT_BuchlaBongo_SleepingGates);
+		}
+		else
+		{
+			DEC_DWORD_STAT(STAT_BuchlaBongo_ActiveGates);
+		}
+	}
+
+	template<int32 NumVoices>
+	void TLowPassGateVoiceBankOperator<NumVoices>::Reset(const FOperatorSettings& InSettings)
+	{
+		//Assigned through the references rather than recreated, whatever reads the outputs keeps reading the same objects
+		if (NumFramesPerBlock != InSettings.GetNumFramesPerBlock())
+		{
+			*AudioOutput = FAudioBuffer(InSettings);
+			*OnDone = FTrigger(InSettings);
+			EnvelopeFrames.SetNumZeroed(InSettings.GetNumFramesPerBlock() * NumVoices);
+		}
+
+		ResetState(InSettings);
+	}
+
+	template<int32 NumVoices>
+	void TLowPassGateVoiceBankOperator<NumVoices>::ResetState(const FOperatorSettings& InSettings)
+	{
+		NumFramesPerBlock = InSettings.GetNumFramesPerBlock();
+		SampleRate = InSettings.GetSampleRate();
+
+		const LowPassGateDSP::FSVFCoefficients Coefficients;
+		for (int32 Voice = 0; Voice < NumVoices; ++Voice)
+		{
+			FilterZ1[Voice] = 0.0f;
+			FilterZ2[Voice] = 0.0f;
+			FilterG[Voice] = Coefficients.G;
+			FilterH[Voice] = Coefficients.H;
+			FilterKPlusG[Voice] = Coefficients.K + Coefficients.G;
+			VoiceGain[Voice] = 0.0f;
+			EnvelopeStates[Voice].Reset();
+			bIsVoiceCulled[Voice] = false;
+			VoiceBudgets[Voice].ResetPeak();
+			VoiceBudgets[Voice].LeaveRanking();
+		}
+		FMemory::Memzero(EnvelopeFrames.GetData(), EnvelopeFrames.Num() * sizeof(float));
+
+		//Forces the coefficients to be rebuilt for the first hit, the sample rate may have changed
+		PreviousCutOff = -1.0f;
+		NextVoice = 0;
+
+		OnDone->Reset();
+		*ActiveVoices = 0;
+		AudioOutput->Zero();
+		bIsOutputCleared = true;
+		SetSleeping(true);
+	}
+
+	template<int32 NumVoices>
+	void TLowPassGateVoiceBankOperator<NumVoices>::SetUsesCpuBudget(bool bInUsesCpuBudget)
+	{
+		BudgetVoice.SetEnabled(bInUsesCpuBudget);
+		for (FLowPassGateBudgetVoice& VoiceBudget : VoiceBudgets)
+		{
+			VoiceBudget.SetEnabled(bInUsesCpuBudget);
+		}
+	}
+
+	template<int32 NumVoices>
+	void TLowPassGateVoiceBankOperator<NumVoices>::SetSleeping(bool bInIsSleeping)
+	{
+		if (bInIsSleeping == bIsSleeping)
+		{
+			return;
+		}
+
+		if (bInIsSleeping)
+		{
+			DEC_DWORD_STAT(STAT_BuchlaBongo_ActiveGates);
+			INC_DWORD_STAT(STAT_BuchlaBongo_SleepingGates);
+		}
+		else
+		{
+			DEC_DWORD_STAT(STAT_BuchlaBongo_SleepingGates);
+			INC_DWORD_STAT(STAT_BuchlaBongo_ActiveGates);
+		}
+
+		bIsSleeping = bInIsSleeping;
+	}
+
+	template<int32 NumVoices>
+	FDataReferenceCollection TLowPassGateVoiceBankOperator<NumVoices>::GetInputs() const
+	{
+		using namespace LowPassGateVoiceBank;
+
+		FDataReferenceCollection Inputs;
+		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputTrigger), TriggerAttackIn);
+		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputAttackTime), AttackTime);
+		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputDecayTime), DecayTime);
+		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputAttackCurve), AttackCurveFactor);
+		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputDecayCurve), DecayCurveFactor);
+		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputAudio), AudioInput);
+		Inputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(InputCutOff), CutOffFrequency);
+
+		return Inputs;
+	}
+
+	template<int32 NumVoices>
+	FDataReferenceCollection TLowPassGateVoiceBankOperator<NumVoices>::GetOutputs() const
+	{
+		using namespace LowPassGateVoiceBank;
+
+		FDataReferenceCollection Outputs;
+		Outputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputOnDone), OnDone);
+		Outputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputActiveVoices), ActiveVoices);
+		Outputs.AddDataReadReference(METASOUND_GET_PARAM_NAME(OutputAudio), AudioOutput);
+
+		return Outputs;
+	}
+
+	template<int32 NumVoices>
+	int32 TLowPassGateVoiceBankOperator<NumVoices>::AllocateVoice()
+	{
+		//Prefer a free voice, searching round robin so consecutive hits spread across the lanes
+		for (int32 Offset = 0; Offset < NumVoices; ++Offset)
+		{
+			const int32 Voice = (NextVoice + Offset) % NumVoices;
+			if (EnvelopeStates[Voice].CurrentSampleIndex == INDEX_NONE)
+			{
+				NextVoice = (Voice + 1) % NumVoices;
+				return Voice;
+			}
+		}
+
+		//Every voice is sounding, steal the quietest
+		int32 QuietestVoice = 0;
+		for (int32 Voice = 1; Voice < NumVoices; ++Voice)
+		{
+			if (EnvelopeStates[Voice].CurrentEnvelopeValue < EnvelopeStates[QuietestVoice].CurrentEnvelopeValue)
+			{
+				QuietestVoice = Voice;
+			}
+		}
+
+		NextVoice = (QuietestVoice + 1) % NumVoices;
+		return QuietestVoice;
+	}
+
+	template<int32 NumVoices>
+	void TLowPassGateVoiceBankOperator<NumVoices>::StartVoice(int32 InVoice)
+	{
+		FEnvelopeState& State = EnvelopeStates[InVoice];
+
+		//A free voice starts from silence, a stolen one keeps its filter and envelope value so it does not click
+		if (State.CurrentSampleIndex == INDEX_NONE)
+		{
+			FilterZ1[InVoice] = 0.0f;
+			FilterZ2[InVoice] = 0.0f;
+			State.CurrentEnvelopeValue = 0.0f;
+		}
+
+		State.AttackSampleCount = FMath::Max(1, SampleRate * AttackTime->GetSeconds());
+		State.DecaySampleCount = FMath::Max(1, SampleRate * DecayTime->GetSeconds());
+		//Curves are latched per voice like the cut off, there is nothing to ramp from
+		State.SetCurveFactors(FMath::Max(KINDA_SMALL_NUMBER, *AttackCurveFactor), FMath::Max(KINDA_SMALL_NUMBER, *DecayCurveFactor), 0);
+		const int32 MinControlRate = BudgetVoice.GetDegradation() >= ELowPassGateDegradation::ControlRateEnvelope ? FLowPassGateBudget::DegradedControlRate : 1;
+		State.ControlRate = FMath::Max(BuchlaBongoCVars::GetEnvelopeControlRate(), MinControlRate);
+		Envelope::Retrigger(State);
+
+		//Treated as full scale on starting, so the attack of a new hit is never taken for a quiet voice
+		bIsVoiceCulled[InVoice] = false;
+		VoiceBudgets[InVoice].ResetPeak();
+
+		//Cut off is latched per voice at trigger time, the tan() is only redone when a hit brings a new one
+		if (*CutOffFrequency != PreviousCutOff)
+		{
+			PreviousCutOff = *CutOffFrequency;
+			CutOffCoefficients.Set(PreviousCutOff, 0.0f, SampleRate);
+			//Same cut off to gain mapping as the single gate's Both mode
+			CutOffGain = FMath::GetMappedRangeValueClamped(TRange<float>(0.0f, 1500.0f), TRange<float>(0.0f, 1.0f), PreviousCutOff);
+		}
+		FilterG[InVoice] = CutOffCoefficients.G;
+		FilterH[InVoice] = CutOffCoefficients.H;
+		FilterKPlusG[InVoice] = CutOffCoefficients.K + CutOffCoefficients.G;
+		VoiceGain[InVoice] = CutOffGain;
+	}
+
+	template<int32 NumVoices>
+	void TLowPassGateVoiceBankOperator<NumVoices>::RenderEnvelopes(int32 StartFrame, int32 EndFrame)
+	{
+		float* Envelopes = EnvelopeFrames.GetData();
+
+		for (int32 Group = 0; Group < NumLaneGroups; ++Group)
+		{
+			FinishedFrames.Reset();
+			Envelope::GetNextEnvelopeOutputLanes(&EnvelopeStates[Group * 4], StartFrame, EndFrame, FinishedFrames, &Envelopes[Group * 4], NumVoices);
+
+			for (int32 FrameFinished : FinishedFrames)
+			{
+				OnDone->TriggerFrame(FrameFinished);
+			}
+		}
+	}
+
+	template<int32 NumVoices>
+	void TLowPassGateVoiceBankOperator<NumVoices>::RenderVoices(const float* InAudio, float* OutAudio, int32 InNumSamples)
+	{
+		VectorRegister4Float Z1[NumLaneGroups];
+		VectorRegister4Float Z2[NumLaneGroups];
+		VectorRegister4Float G[NumLaneGroups];
+		VectorRegister4Float H[NumLaneGroups];
+		VectorRegister4Float KPlusG[NumLaneGroups];
+		VectorRegister4Float Gain[NumLaneGroups];
+
+		for (int32 Group = 0; Group < NumLaneGroups; ++Group)
+		{
+			Z1[Group] = VectorLoadAligned(&FilterZ1[Group * 4]);
+			Z2[Group] = VectorLoadAligned(&FilterZ2[Group * 4]);
+			G[Group] = VectorLoadAligned(&FilterG[Group * 4]);
+			H[Group] = VectorLoadAligned(&FilterH[Group * 4]);
+			KPlusG[Group] = VectorLoadAligned(&FilterKPlusG[Group * 4]);
+			Gain[Group] = VectorLoadAligned(&VoiceGain[Group * 4]);
+		}
+
+		const float* Envelopes = EnvelopeFrames.GetData();
+		alignas(16) float Lanes[4];
+
+		for (int32 i = 0; i < InNumSamples; ++i)
+		{
+			const VectorRegister4Float Input = VectorLoadFloat1(&InAudio[i]);
+			const float* FrameEnvelopes = &Envelopes[i * NumVoices];
+			VectorRegister4Float Sum = VectorZeroFloat();
+
+			for (int32 Group = 0; Group < NumLaneGroups; ++Group)
+			{
+				//Same filter step as LowPassGateDSP::ProcessLowPassSample, four voices at a time
+				const VectorRegister4Float HighPass = VectorMultiply(VectorSubtract(VectorSubtract(Input, VectorMultiply(KPlusG[Group], Z1[Group])), Z2[Group]), H[Group]);
+				const VectorRegister4Float BandPass = VectorMultiplyAdd(G[Group], HighPass, Z1[Group]);
+				const VectorRegister4Float LowPass = VectorMultiplyAdd(G[Group], BandPass, Z2[Group]);
+				Z1[Group] = VectorMultiplyAdd(G[Group], HighPass, BandPass);
+				Z2[Group] = VectorMultiplyAdd(G[Group], BandPass, LowPass);
+
+				const VectorRegister4Float Gate = VectorMultiply(VectorLoadAligned(&FrameEnvelopes[Group * 4]), Gain[Group]);
+				Sum = VectorMultiplyAdd(LowPass, Gate, Sum);
+			}
+
+			VectorStoreAligned(Sum, Lanes);
+			OutAudio[i] = (Lanes[0] + Lanes[1]) + (Lanes[2] + Lanes[3]);
+		}
+
+		for (int32 Group = 0; Group < NumLaneGroups; ++Group)
+		{
+			VectorStoreAligned(Z1[Group], &FilterZ1[Group * 4]);
+			VectorStoreAligned(Z2[Group], &FilterZ2[Group * 4]);
+		}
+
+		for (int32 Voice = 0; Voice < NumVoices; ++Voice)
+		{
+			FilterZ1[Voice] = LowPassGateDSP::FlushDenormal(FilterZ1[Voice]);
+			FilterZ2[Voice] = LowPassGateDSP::FlushDenormal(FilterZ2[Voice]);
+		}
+	}
+
+	template<int32 NumVoices>
+	void TLowPassGateVoiceBankOperator<NumVoices>::CullQuietVoices()
+	{
+		//Envelopes are never negative, so the gated envelope's peak is a plain max across the block
+		VectorRegister4Float Peaks[NumLaneGroups];
+		for (int32 Group = 0; Group < NumLaneGroups; ++Group)
+		{
+			Peaks[Group] = VectorZeroFloat();
+		}
+
+		const float* Envelopes = EnvelopeFrames.GetData();
+		for (int32 Frame = 0; Frame < NumFramesPerBlock; ++Frame)
+		{
+			const float* FrameEnvelopes = &Envelopes[Frame * NumVoices];
+			for (int32 Group = 0; Group < NumLaneGroups; ++Group)
+			{
+				Peaks[Group] = VectorMax(Peaks[Group], VectorLoadAligned(&FrameEnvelopes[Group * 4]));
+			}
+		}
+
+		//Every voice hears the same input, so the gate it applies is what sets one voice apart from another
+		alignas(16) float VoicePeaks[NumVoices];
+		for (int32 Group = 0; Group < NumLaneGroups; ++Group)
+		{
+			VectorStoreAligned(VectorMultiply(Peaks[Group], VectorLoadAligned(&VoiceGain[Group * 4])), &VoicePeaks[Group * 4]);
+		}
+
+		for (int32 Voice = 0; Voice < NumVoices; ++Voice)
+		{
+			if (EnvelopeStates[Voice].CurrentSampleIndex != INDEX_NONE && VoiceBudgets[Voice].ShouldCull(VoicePeaks[Voice]))
+			{
+				FastReleaseVoice(Voice);
+			}
+		}
+	}
+
+	template<int32 NumVoices>
+	void TLowPassGateVoiceBankOperator<NumVoices>::FastReleaseVoice(int32 InVoice)
+	{
+		//Same one block release as a culled low pass gate, applied to the voice's envelope before the voices are summed
+		float* VoiceEnvelope = &EnvelopeFrames[InVoice];
+		const float FadeStep = 1.0f / NumFramesPerBlock;
+		for (int32 Frame = 0; Frame < NumFramesPerBlock; ++Frame)
+		{
+			VoiceEnvelope[Frame * NumVoices] *= 1.0f - Frame * FadeStep;
+		}
+
+		//Anything waiting on the voice still hears it finish
+		OnDone->TriggerFrame(NumFramesPerBlock - 1);
+		EnvelopeStates[InVoice].CurrentSampleIndex = INDEX_NONE;
+		EnvelopeStates[InVoice].CurrentEnvelopeValue = 0.0f;
+		bIsVoiceCulled[InVoice] = true;
+
+		INC_DWORD_STAT(STAT_BuchlaBongo_CulledGates);
+	}
+
+	template<int32 NumVoices>
+	void TLowPassGateVoiceBankOperator<NumVoices>::Execute()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(BuchlaBongo::VoiceBankExecute);
+		SCOPE_CYCLE_COUNTER(STAT_BuchlaBongo_VoiceBankExecute);
+
+#if BUCHLABONGO_RENDER_ALLOCATION_CHECKS
+		//Only counts while allocation tracking is installed, see BuchlaBongoAllocations.h
+		BuchlaBongoAllocations::FRenderScope AllocationScope(TEXT("Buchla LPG Voice Bank"));
+#endif
+
+		const uint64 StartCycles = BudgetVoice.BeginBlock();
+		ON_SCOPE_EXIT
+		{
+			BudgetVoice.EndBlock(StartCycles, SampleRate, NumFramesPerBlock);
+		};
+
+		OnDone->AdvanceBlock();
+
+		//With no voice sounding and no new hit the whole bank is asleep
+		const int32 NumTriggers = TriggerAttackIn->NumTriggeredInBlock();
+		if (*ActiveVoices == 0 && NumTriggers == 0)
+		{
+			SetSleeping(true);
+			if (!bIsOutputCleared)
+			{
+				AudioOutput->Zero();
+				bIsOutputCleared = true;
+			}
+			return;
+		}
+		SetSleeping(false);
+		bIsOutputCleared = false;
+		INC_DWORD_STAT_BY(STAT_BuchlaBongo_Triggers, NumTriggers);
+
+		//One pass over the block, the envelopes are rendered up to each trigger and the trigger starts its voice in place
+		//Unlike the single gate a second trigger on the same frame is not merged, it starts a voice of its own
+		int32 Frame = 0;
+		for (int32 TriggerIndex = 0; TriggerIndex <= NumTriggers; ++TriggerIndex)
+		{
+			const int32 EndFrame = TriggerIndex < NumTriggers ? FMath::Clamp((*TriggerAttackIn)[TriggerIndex], Frame, NumFramesPerBlock) : NumFramesPerBlock;
+			if (EndFrame > Frame)
+			{
+				RenderEnvelopes(Frame, EndFrame);
+				Frame = EndFrame;
+			}
+
+			if (TriggerIndex < NumTriggers && EndFrame < NumFramesPerBlock)
+			{
+				StartVoice(AllocateVoice());
+			}
+		}
+
+		if (BudgetVoice.IsMeasuring())
+		{
+			CullQuietVoices();
+		}
+
+		RenderVoices(AudioInput->GetData(), AudioOutput->GetData(), AudioInput->Num());
+
+		int32 NumActiveVoices = 0;
+		for (int32 Voice = 0; Voice < NumVoices; ++Voice)
+		{
+			if (EnvelopeStates[Voice].CurrentSampleIndex != INDEX_NONE)
+			{
+				++NumActiveVoices;
+			}
+			else if (!bIsVoiceCulled[Voice])
+			{
+				//Idle voices drop out of the ranking, culled ones keep their place like a culled gate
+				VoiceBudgets[Voice].LeaveRanking();
+			}
+		}
+		*ActiveVoices = NumActiveVoices;
+	}
+
+	template class TLowPassGateVoiceBankOperator<8>;
+	template class TLowPassGateVoiceBankOperator<16>;
+
+	template<int32 NumVoices>
+	class TLowPassGateVoiceBankNode : public FNodeFacade
+	{
+	public:
+		TLowPassGateVoiceBankNode(const FNodeInitData& InInitData)
+			: FNodeFacade(InInitData.InstanceName, InInitData.InstanceID, TFacadeOperatorClass<TLowPassGateVoiceBankOperator<NumVoices>>())
+		{}
+	};
+
+	using FLowPassGateVoiceBankNode8 = TLowPassGateVoiceBankNode<8>;
+	using FLowPassGateVoiceBankNode16 = TLowPassGateVoiceBankNode<16>;
+
+	METASOUND_REGISTER_NODE(FLowPassGateVoiceBankNode8);
+	METASOUND_REGISTER_NODE(FLowPassGateVoiceBankNode16);
+}
+
+#undef LOCTEXT_NAMESPACE
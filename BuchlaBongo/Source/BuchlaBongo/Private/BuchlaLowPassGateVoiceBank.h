@@ -0,0 +1,120 @@
+#pragma once
+
+#include "MetasoundExecutableOperator.h"
+#include "MetasoundNodeInterface.h"
+#include "MetasoundPrimitives.h"
+#include "MetasoundTrigger.h"
+#include "MetasoundTime.h"
+#include "MetasoundAudioBuffer.h"
+#include "BuchlaEnvelope.h"
+#include "BuchlaLowPassGateDSP.h"
+#include "BuchlaLowPassGateBudget.h"
+#include "BuchlaBongoAllocations.h"
+#include "Misc/EngineVersionComparison.h"
+
+namespace Metasound
+{
+	//Runs several Both mode low pass gates in one operator instead of one node per voice
+	//Envelope and filter state is stored structure-of-arrays so four voices are enveloped, filtered and gated with each vector operation
+	//Declared here so the allocation tests can drive the operator directly
+	template<int32 NumVoices>
+	class TLowPassGateVoiceBankOperator : public TExecutableOperator<TLowPassGateVoiceBankOperator<NumVoices>>
+	{
+		static_assert(NumVoices > 0 && NumVoices % 4 == 0, "Voices are processed four lanes at a time");
+		static constexpr int32 NumLaneGroups = NumVoices / 4;
+
+	public:
+		static const FNodeClassMetadata& GetNodeInfo();
+		static const FVertexInterface& GetVertexInterface();
+		static TUniquePtr<IOperator> CreateOperator(const FCreateOperatorParams& InParams, FBuildErrorArray& OutErrors);
+
+		TLowPassGateVoiceBankOperator(const FOperatorSettings& InSettings,
+			const FTriggerReadRef& InTriggerIn,
+			const FTimeReadRef& InAttackTime,
+			const FTimeReadRef& InDecayTime,
+			const FFloatReadRef& InAttackCurveFactor,
+			const FFloatReadRef& InDecayCurveFactor,
+			const FAudioBufferReadRef& InAudioInput,
+			const FFloatReadRef& InCutOff);
+		virtual ~TLowPassGateVoiceBankOperator();
+
+		virtual FDataReferenceCollection GetInputs() const override;
+		virtual FDataReferenceCollection GetOutputs() const override;
+
+		void Execute();
+
+		//Readies the operator for reuse at InSettings, the outputs keep their identity so existing bindings stay valid
+		void Reset(const FOperatorSettings& InSettings);
+#if !UE_VERSION_OLDER_THAN(5, 3, 0)
+		//Lets the engine pool and reuse the operator instead of rebuilding it for every new source
+		void Reset(const IOperator::FResetParams& InParams) { Reset(InParams.OperatorSettings); }
+#endif
+		//Silences every voice, shared by the constructor and Reset()
+		void ResetState(const FOperatorSettings& InSettings);
+
+		//Takes the bank and its voices in or out of FLowPassGateBudget, see FLowPassGateBudgetVoice::SetEnabled
+		void SetUsesCpuBudget(bool bInUsesCpuBudget);
+
+	private:
+		int32 AllocateVoice();
+		void StartVoice(int32 InVoice);
+		//Writes every voice's envelope for the frames [StartFrame, EndFrame) into EnvelopeFrames, one lane group at a time
+		void RenderEnvelopes(int32 StartFrame, int32 EndFrame);
+		void RenderVoices(const float* InAudio, float* OutAudio, int32 InNumSamples);
+		//Ranks every sounding voice by its gated envelope over the block and releases the ones the budget culls
+		//Runs between RenderEnvelopes and RenderVoices, so a released voice is faded in its envelope rather than in the summed output
+		void CullQuietVoices();
+		void FastReleaseVoice(int32 InVoice);
+		//The bank counts as one gate in the active and sleeping stats, it sleeps while none of its voices sound
+		void SetSleeping(bool bInIsSleeping);
+
+		FTriggerReadRef TriggerAttackIn;
+		FTimeReadRef AttackTime;
+		FTimeReadRef DecayTime;
+		FFloatReadRef AttackCurveFactor;
+		FFloatReadRef DecayCurveFactor;
+		FAudioBufferReadRef AudioInput;
+		FFloatReadRef CutOffFrequency;
+
+		FTriggerWriteRef OnDone;
+		FInt32WriteRef ActiveVoices;
+		FAudioBufferWriteRef AudioOutput;
+
+		float SampleRate = 0.0f;
+		int32 NumFramesPerBlock = 0;
+
+		alignas(16) float FilterZ1[NumVoices];
+		alignas(16) float FilterZ2[NumVoices];
+		alignas(16) float FilterG[NumVoices];
+		alignas(16) float FilterH[NumVoices];
+		alignas(16) float FilterKPlusG[NumVoices];
+		alignas(16) float VoiceGain[NumVoices];
+
+		//Filter coefficients and gain of the last cut off a voice was started with, most hits reuse them
+		float PreviousCutOff = -1.0f;
+		LowPassGateDSP::FSVFCoefficients CutOffCoefficients;
+		float CutOffGain = 0.0f;
+
+		//Every four consecutive states are one lane group of Envelope::GetNextEnvelopeOutputLanes
+		FEnvelopeState EnvelopeStates[NumVoices];
+		//Interleaved as [Frame * NumVoices + Voice] so one frame of a lane group is a single aligned load
+		TArray<float, TAlignedHeapAllocator<16>> EnvelopeFrames;
+		//Reused by every lane group so finishing voices never allocate on the render thread
+		TArray<int32> FinishedFrames;
+		//Times the whole bank and decides how far it is degraded, the bank reports one cost however many voices sound
+		FLowPassGateBudgetVoice BudgetVoice;
+		//Only used for their place in the ranking, so the budget culls single voices rather than the whole bank
+		FLowPassGateBudgetVoice VoiceBudgets[NumVoices];
+		bool bIsVoiceCulled[NumVoices];
+		int32 NextVoice = 0;
+		bool bIsOutputCleared = false;
+		bool bIsSleeping = false;
+	};
+
+	using FLowPassGateVoiceBankOperator8 = TLowPassGateVoiceBankOperator<8>;
+	using FLowPassGateVoiceBankOperator16 = TLowPassGateVoiceBankOperator<16>;
+
+	//Instantiated in BuchlaLowPassGateVoiceBank.cpp for every voice count that has a node
+	extern template class TLowPassGateVoiceBankOperator<8>;
+	extern template class TLowPassGateVoiceBankOperator<16>;
+}
@@ -0,0 +1,129 @@
+#include "BuchlaEnvelope.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace Metasound
+{
+	namespace EnvelopeTests
+	{
+		//One hit from silence, rendered in a single range
+		static TArray<float> RenderHit(int32 InAttackSamples, int32 InDecaySamples, float InCurve, int32 InControlRate)
+		{
+			FEnvelopeState State;
+			State.AttackSampleCount = InAttackSamples;
+			State.DecaySampleCount = InDecaySamples;
+			State.SetCurveFactors(InCurve, InCurve, 0);
+			State.ControlRate = InControlRate;
+			Envelope::Retrigger(State);
+
+			TArray<float> Values;
+			Values.SetNumZeroed(InAttackSamples + InDecaySamples + 16);
+			TArray<int32> FinishedFrames;
+			Envelope::GetNextEnvelopeOutput(State, 0, Values.Num(), FinishedFrames, Values.GetData());
+			return Values;
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBuchlaEnvelopeControlRateTest, "BuchlaBongo.Envelope.ControlRateSegmentEnd", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FBuchlaEnvelopeControlRateTest::RunTest(const FString& Parameters)
+{
+	using namespace Metasound;
+	using namespace EnvelopeTests;
+
+	//48 samples is one and a half control periods at 32, the last run is the partial one
+	constexpr int32 AttackSamples = 48;
+	constexpr int32 DecaySamples = 100;
+	constexpr int32 ControlRate = 32;
+
+	{
+		//A linear curve has nothing to interpolate, the control rate render is the per-sample one up to the fast pow rounding
+		const TArray<float> PerSample = RenderHit(AttackSamples, DecaySamples, 1.0f, 1);
+		const TArray<float> Controlled = RenderHit(AttackSamples, DecaySamples, 1.0f, ControlRate);
+
+		float MaxError = 0.0f;
+		for (int32 i = 0; i < PerSample.Num(); ++i)
+		{
+			MaxError = FMath::Max(MaxError, FMath::Abs(PerSample[i] - Controlled[i]));
+		}
+		TestTrue(FString::Printf(TEXT("Linear control rate envelope is within 1e-3 of per sample, error %f"), MaxError), MaxError <= 1.0e-3f);
+		TestEqual(TEXT("Last attack sample"), Controlled[AttackSamples - 1], PerSample[AttackSamples - 1], 1.0e-3f);
+	}
+
+	{
+		//The attack ramps into 1.0 at its end, so the decay carries on from the same value without a step
+		const TArray<float> Controlled = RenderHit(AttackSamples, DecaySamples, 2.0f, ControlRate);
+
+		TestEqual(TEXT("Decay starts at 1"), Controlled[AttackSamples], 1.0f);
+		const float LastStep = Controlled[AttackSamples] - Controlled[AttackSamples - 1];
+		TestTrue(FString::Printf(TEXT("Step from attack into decay is one interpolation step, got %f"), LastStep), LastStep >= 0.0f && LastStep <= 1.0f / (AttackSamples - ControlRate));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBuchlaEnvelopeLanesTest, "BuchlaBongo.Envelope.Lanes", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FBuchlaEnvelopeLanesTest::RunTest(const FString& Parameters)
+{
+	using namespace Metasound;
+
+	//Four lanes caught in different places, idle, mid attack at a control rate, a one sample attack and close to the end of the decay
+	FEnvelopeState Lanes[4];
+	Lanes[1].AttackSampleCount = 300;
+	Lanes[1].DecaySampleCount = 500;
+	Lanes[1].SetCurveFactors(2.0f, 0.5f, 0);
+	Lanes[1].ControlRate = 16;
+	Envelope::Retrigger(Lanes[1]);
+	Lanes[1].CurrentSampleIndex = 37;
+	Lanes[2].AttackSampleCount = 1;
+	Lanes[2].DecaySampleCount = 200;
+	Lanes[2].SetCurveFactors(1.0f, 3.0f, 0);
+	Envelope::Retrigger(Lanes[2]);
+	Lanes[3].AttackSampleCount = 20;
+	Lanes[3].DecaySampleCount = 100;
+	Lanes[3].SetCurveFactors(1.0f, 1.0f, 0);
+	Envelope::Retrigger(Lanes[3]);
+	Lanes[3].StartingEnvelopeValue = 0.4f;
+	Lanes[3].CurrentSampleIndex = 90;
+
+	FEnvelopeState Scalar[4];
+	for (int32 Lane = 0; Lane < 4; ++Lane)
+	{
+		Scalar[Lane] = Lanes[Lane];
+	}
+
+	//Several ranges so the lanes carry their position over, with the second starting mid block as after a trigger
+	constexpr int32 NumFrames = 256;
+	TArray<float, TAlignedHeapAllocator<16>> Interleaved;
+	Interleaved.SetNumZeroed(NumFrames * 4);
+	TArray<float> Values;
+	Values.SetNumZeroed(NumFrames);
+	TArray<int32> LanesFinished;
+	TArray<int32> ScalarFinished;
+
+	float MaxError = 0.0f;
+	const int32 Ranges[] = { 0, 77, 256 };
+	for (int32 Range = 0; Range + 1 < UE_ARRAY_COUNT(Ranges); ++Range)
+	{
+		Envelope::GetNextEnvelopeOutputLanes(Lanes, Ranges[Range], Ranges[Range + 1], LanesFinished, Interleaved.GetData(), 4);
+		for (int32 Lane = 0; Lane < 4; ++Lane)
+		{
+			Envelope::GetNextEnvelopeOutput(Scalar[Lane], Ranges[Range], Ranges[Range + 1], ScalarFinished, Values.GetData());
+			for (int32 Frame = Ranges[Range]; Frame < Ranges[Range + 1]; ++Frame)
+			{
+				MaxError = FMath::Max(MaxError, FMath::Abs(Interleaved[Frame * 4 + Lane] - Values[Frame]));
+			}
+			TestEqual(FString::Printf(TEXT("Lane %d position after range %d"), Lane, Range), Lanes[Lane].CurrentSampleIndex, Scalar[Lane].CurrentSampleIndex);
+		}
+	}
+
+	TestTrue(FString::Printf(TEXT("Lanes are within 1e-3 of the scalar envelope, error %f"), MaxError), MaxError <= 1.0e-3f);
+	TestTrue(TEXT("Lanes finish on the same frames as the scalar envelope"), LanesFinished == ScalarFinished);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,166 @@
+#include "BuchlaLowPassGateHarness.h"
+#include "BuchlaBongoAllocations.h"
+#include "BuchlaLowPassGateControl.h"
+#include "BuchlaLowPassGateVoiceBank.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && BUCHLABONGO_WITH_DEV_TOOLS && BUCHLABONGO_RENDER_ALLOCATION_CHECKS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBuchlaLowPassGateRenderAllocationTest, "BuchlaBongo.LowPassGate.RenderAllocations", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FBuchlaLowPassGateRenderAllocationTest::RunTest(const FString& Parameters)
+{
+	using namespace Metasound;
+
+	static const TCHAR* ModeNames[] = { TEXT("LowPass"), TEXT("VCA"), TEXT("Both"), TEXT("Vactrol"), TEXT("Follower") };
+	static const ELowPassGateMode Modes[] = { ELowPassGateMode::LowPass, ELowPassGateMode::VCA, ELowPassGateMode::Both, ELowPassGateMode::Vactrol, ELowPassGateMode::Follower };
+	static const ELowPassGateOversampling Rates[] = { ELowPassGateOversampling::None, ELowPassGateOversampling::FourX };
+
+	BuchlaBongoAllocations::FScopedAllocationTracking AllocationTracking;
+	if (!BuchlaBongoAllocations::IsTracking())
+	{
+		AddError(TEXT("The render allocation proxy is not in front of GMalloc"));
+		return false;
+	}
+
+	for (int32 ModeIndex = 0; ModeIndex < UE_ARRAY_COUNT(Modes); ++ModeIndex)
+	{
+		for (ELowPassGateOversampling Rate : Rates)
+		{
+			FLowPassGateHarness Harness(48000.0f, 256, Modes[ModeIndex]);
+			*Harness.Oversampling = Rate;
+			Harness.FillInputWithNoise(1234u);
+
+			//The first hit grows the trigger outputs' frame lists, that happens once per gate and is not checked
+			Harness.Trigger->TriggerFrame(0);
+			Harness.RenderBlock();
+
+			//Single hits, retriggers inside a block and cut off changes, long enough for every hit to finish and the gate to sleep
+			const int32 AllocationsBefore = BuchlaBongoAllocations::GetNumRenderAllocations();
+			for (int32 Block = 0; Block < 200; ++Block)
+			{
+				if (Block % 16 == 0)
+				{
+					Harness.Trigger->TriggerFrame(17);
+					Harness.Trigger->TriggerFrame(130);
+				}
+				*Harness.CutOff = Block % 32 < 16 ? 800.0f : 3000.0f;
+				Harness.RenderBlock();
+			}
+
+			TestEqual(FString::Printf(TEXT("%s allocations at %dx"), ModeNames[ModeIndex], Rate == ELowPassGateOversampling::None ? 1 : 4), BuchlaBongoAllocations::GetNumRenderAllocations() - AllocationsBefore, 0);
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBuchlaLowPassGateQueuedTriggerAllocationTest, "BuchlaBongo.LowPassGate.QueuedTriggerAllocations", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FBuchlaLowPassGateQueuedTriggerAllocationTest::RunTest(const FString& Parameters)
+{
+	using namespace Metasound;
+
+	//Well past what a small inline buffer would hold, and mixed with triggers on the pin so both get merged
+	constexpr int32 GateId = 0x7B0B0;
+	constexpr int32 NumQueuedTriggers = 64;
+
+	BuchlaBongoAllocations::FScopedAllocationTracking AllocationTracking;
+	if (!BuchlaBongoAllocations::IsTracking())
+	{
+		AddError(TEXT("The render allocation proxy is not in front of GMalloc"));
+		return false;
+	}
+
+	FLowPassGateHarness Harness(48000.0f, 256, ELowPassGateMode::Both, 1, GateId);
+	Harness.FillInputWithNoise(1234u);
+
+	auto SendTriggers = [&Harness](int32 InBlock)
+	{
+		TArray<FLowPassGateUpdate> Updates;
+		for (int32 Index = 0; Index < NumQueuedTriggers; ++Index)
+		{
+			FLowPassGateUpdate& Update = Updates.AddDefaulted_GetRef();
+			Update.GateId = GateId;
+			Update.Fields = ELowPassGateUpdateFields::Trigger;
+			//Some land on the same frame as another, those are merged into one
+			Update.TriggerFrame = (Index * 3 + InBlock) % Harness.GetNumFramesPerBlock();
+		}
+		FLowPassGateControl::Get().Send(Updates);
+		Harness.Trigger->TriggerFrame(5);
+		Harness.Trigger->TriggerFrame(200);
+	};
+
+	//The first busy block grows the trigger outputs' frame lists, that happens once per gate and is not checked
+	SendTriggers(0);
+	Harness.RenderBlock();
+
+	const int32 AllocationsBefore = BuchlaBongoAllocations::GetNumRenderAllocations();
+	for (int32 Block = 1; Block < 50; ++Block)
+	{
+		SendTriggers(Block);
+		Harness.RenderBlock();
+	}
+
+	TestEqual(FString::Printf(TEXT("Allocations with %d queued triggers per block"), NumQueuedTriggers), BuchlaBongoAllocations::GetNumRenderAllocations() - AllocationsBefore, 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBuchlaLowPassGateVoiceBankAllocationTest, "BuchlaBongo.LowPassGate.VoiceBankRenderAllocations", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FBuchlaLowPassGateVoiceBankAllocationTest::RunTest(const FString& Parameters)
+{
+	using namespace Metasound;
+
+	BuchlaBongoAllocations::FScopedAllocationTracking AllocationTracking;
+	if (!BuchlaBongoAllocations::IsTracking())
+	{
+		AddError(TEXT("The render allocation proxy is not in front of GMalloc"));
+		return false;
+	}
+
+	const FOperatorSettings Settings(48000, 48000.0f / 256);
+	FTriggerWriteRef Trigger = FTriggerWriteRef::CreateNew(Settings);
+	FFloatWriteRef CutOff = FFloatWriteRef::CreateNew(1500.0f);
+	FAudioBufferWriteRef AudioIn = FAudioBufferWriteRef::CreateNew(Settings);
+	for (int32 i = 0; i < AudioIn->Num(); ++i)
+	{
+		AudioIn->GetData()[i] = (i % 64) / 32.0f - 1.0f;
+	}
+
+	FLowPassGateVoiceBankOperator8 VoiceBank(Settings, Trigger, FTimeWriteRef::CreateNew(FTime(0.005)), FTimeWriteRef::CreateNew(FTime(0.05)),
+		FFloatWriteRef::CreateNew(1.0f), FFloatWriteRef::CreateNew(0.5f), AudioIn, CutOff);
+
+	//More hits per block than voices, so voices are stolen and finish out of order
+	auto RenderBlock = [&](int32 InBlock)
+	{
+		if (InBlock % 8 < 4)
+		{
+			for (int32 Hit = 0; Hit < 12; ++Hit)
+			{
+				Trigger->TriggerFrame(Hit * 21 + InBlock % 5);
+			}
+		}
+		*CutOff = InBlock % 16 < 8 ? 800.0f : 3000.0f;
+		VoiceBank.Execute();
+		Trigger->AdvanceBlock();
+	};
+
+	//The first busy block grows the On Done frame list, that happens once per bank and is not checked
+	RenderBlock(0);
+
+	const int32 AllocationsBefore = BuchlaBongoAllocations::GetNumRenderAllocations();
+	for (int32 Block = 1; Block < 200; ++Block)
+	{
+		RenderBlock(Block);
+	}
+	VoiceBank.Reset(Settings);
+	RenderBlock(0);
+
+	TestEqual(TEXT("Voice bank allocations"), BuchlaBongoAllocations::GetNumRenderAllocations() - AllocationsBefore, 0);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,65 @@
+#include "BuchlaLowPassGateHarness.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && BUCHLABONGO_WITH_DEV_TOOLS
+
+namespace Metasound
+{
+	namespace LowPassGateResetTests
+	{
+		//A single hit on the first frame, rendered for InNumBlocks blocks
+		static TArray<float> RenderHit(FLowPassGateHarness& InHarness, int32 InNumBlocks)
+		{
+			TArray<float> Rendered;
+			InHarness.Trigger->TriggerFrame(0);
+			for (int32 Block = 0; Block < InNumBlocks; ++Block)
+			{
+				InHarness.RenderBlock();
+				Rendered.Append(InHarness.GetOutput(0).GetData(), InHarness.GetOutput(0).Num());
+			}
+			return Rendered;
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBuchlaLowPassGateResetTest, "BuchlaBongo.LowPassGate.Reset", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FBuchlaLowPassGateResetTest::RunTest(const FString& Parameters)
+{
+	using namespace Metasound;
+	using namespace LowPassGateResetTests;
+
+	//A reset operator renders exactly what a new one does
+	{
+		FLowPassGateHarness Harness(48000.0f, 256, ELowPassGateMode::Vactrol);
+		Harness.FillInputWithNoise(1234u);
+
+		const TArray<float> First = RenderHit(Harness, 16);
+		Harness.GetOperator(0).Reset(Harness.Settings);
+		const TArray<float> Second = RenderHit(Harness, 16);
+
+		bool bMatches = First.Num() == Second.Num();
+		for (int32 i = 0; bMatches && i < First.Num(); ++i)
+		{
+			bMatches = First[i] == Second[i];
+		}
+		TestTrue(TEXT("Render after Reset matches the first render"), bMatches);
+	}
+
+	//The outputs are resized in place for a larger block, so existing readers see the new size
+	{
+		FLowPassGateHarness Harness(48000.0f, 256, ELowPassGateMode::Both);
+		const FDataReferenceCollection Outputs = Harness.GetOperator(0).GetOutputs();
+		const FAudioBufferReadRef AudioOut = Outputs.GetDataReadReference<FAudioBuffer>(TEXT("Out"));
+
+		const FOperatorSettings LargerBlock(48000, 48000.0f / 1024);
+		Harness.GetOperator(0).Reset(LargerBlock);
+
+		TestEqual(TEXT("Output frames after Reset to a larger block"), AudioOut->Num(), LargerBlock.GetNumFramesPerBlock());
+		TestTrue(TEXT("Harness output is the same buffer"), &Harness.GetOutput(0) == &(*AudioOut));
+	}
+
+	return true;
+}
+
+#endif
@@ -4,6 +4,9 @@
 
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "Containers/Ticker.h"
+
+BUCHLABONGO_API DECLARE_LOG_CATEGORY_EXTERN(LogBuchlaBongo, Log, All);
 
 class FBuchlaBongoModule : public IModuleInterface
 {
@@ -12,4 +15,8 @@ public:
 	/** IModuleInterface implementation */
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+private:
+	//Frees the hits the Low Pass Gate cache retired once no gate is playing them any more
+	FTSTicker::FDelegateHandle HitCacheTickerHandle;
 };
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "BuchlaLowPassGateHitCache.h"
+
+namespace Metasound
+{
+	//One offline pass of the gate over a prepared input buffer
+	struct FLowPassGateBatchJob
+	{
+		TArrayView<const float> Input;
+		//ExcitationId is ignored, batch renders always run the gate live
+		FLowPassGateHitParams Params;
+		//Frames relative to the start of Input, in ascending order
+		TArray<int32> TriggerFrames;
+		//Frames to render, 0 renders Input.Num() frames, the input reads as silence past its end
+		int32 NumFrames = 0;
+	};
+
+	//Renders many independent gate passes across the task graph
+	//Every worker keeps its own gate harness and reuses it from job to job, so jobs share no locks
+	//Output buffers and workers are set up front on the calling thread, the workers never allocate unless a job changes sample rate
+	class BUCHLABONGO_API FLowPassGateBatchRenderer
+	{
+	public:
+		static constexpr int32 DefaultBlockSize = 256;
+
+		//Blocks until every job is rendered, OutResults[i] holds the output of InJobs[i]
+		static void Render(TArrayView<const FLowPassGateBatchJob> InJobs, TArray<TArray<float>>& OutResults, int32 InBlockSize = DefaultBlockSize, bool bInSingleThreaded = false);
+	};
+}
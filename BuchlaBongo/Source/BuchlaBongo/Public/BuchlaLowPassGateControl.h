@@ -0,0 +1,66 @@
+#pragma once
+
+#include "BuchlaLowPassGateTypes.h"
+#include "HAL/CriticalSection.h"
+
+namespace Metasound
+{
+	enum class ELowPassGateUpdateFields : uint8
+	{
+		None = 0,
+		CutOff = 1 << 0,
+		Mode = 1 << 1,
+		AttackTime = 1 << 2,
+		DecayTime = 1 << 3,
+		Trigger = 1 << 4,
+		//Drops every value sent before, applied ahead of the other fields of the same update
+		ClearOverrides = 1 << 5
+	};
+	ENUM_CLASS_FLAGS(ELowPassGateUpdateFields);
+
+	//Any mix of parameter changes and a trigger for every gate with a matching Gate ID, applied together at the start of a block
+	struct FLowPassGateUpdate
+	{
+		int32 GateId = 0;
+		ELowPassGateUpdateFields Fields = ELowPassGateUpdateFields::None;
+		float CutOff = 1500.0f;
+		ELowPassGateMode Mode = ELowPassGateMode::LowPass;
+		float AttackTime = 0.01f;
+		float DecayTime = 0.1f;
+		//Frame within the block the update is applied in that the trigger lands on, clamped to the block
+		int32 TriggerFrame = 0;
+	};
+
+	//Single producer single consumer, the game thread writes and one gate operator reads at the start of its Execute()
+	using FLowPassGateUpdateQueue = TCircularQueue<FLowPassGateUpdate>;
+
+	//Routes updates from the game thread to the gates, every gate gets its own queue so there is only ever one reader per queue
+	//The lock is only taken on the game thread and when gates are created or destroyed, never by a rendering gate
+	class BUCHLABONGO_API FLowPassGateControl
+	{
+	public:
+		//Room for a few hundred updates per gate between two audio renders
+		static constexpr uint32 QueueCapacity = 256;
+
+		static FLowPassGateControl& Get();
+
+		//Game thread only, one lock for the whole batch however many gates it reaches
+		void Send(TArrayView<const FLowPassGateUpdate> InUpdates);
+		void Send(const FLowPassGateUpdate& InUpdate) { Send(MakeArrayView(&InUpdate, 1)); }
+
+		//Called by gates with a non-zero Gate ID when they are constructed, never from the render thread, the returned queue belongs to that gate alone
+		FLowPassGateUpdateQueuePtr Register(int32 InGateId);
+		void Unregister(int32 InGateId, const FLowPassGateUpdateQueuePtr& InQueue);
+
+	private:
+		struct FGateQueue
+		{
+			FLowPassGateUpdateQueuePtr Queue;
+			//Set when the queue first fills, cleared once the gate has drained it so the next stall is reported too
+			bool bHasWarnedFull = false;
+		};
+
+		FCriticalSection QueuesCritSection;
+		TMap<int32, TArray<FGateQueue>> Queues;
+	};
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "BuchlaLowPassGateTypes.h"
+#include "HAL/CriticalSection.h"
+
+#include <atomic>
+
+namespace Metasound
+{
+	//Everything that decides how a single hit from an idle gate sounds
+	//ExcitationId names the audio fed to the gate's In pin, it is up to the caller to keep ids and samples in step
+	struct BUCHLABONGO_API FLowPassGateHitParams
+	{
+		float SampleRate = 48000.0f;
+		float AttackTime = 0.01f;
+		float DecayTime = 0.1f;
+		float AttackCurve = 1.0f;
+		float DecayCurve = 0.5f;
+		float CutOff = 1500.0f;
+		float Resonance = 0.0f;
+		ELowPassGateMode Mode = ELowPassGateMode::Both;
+		ELowPassGateOversampling Oversampling = ELowPassGateOversampling::None;
+		int32 ExcitationId = 0;
+
+		bool operator==(const FLowPassGateHitParams& InOther) const;
+		bool operator!=(const FLowPassGateHitParams& InOther) const { return !(*this == InOther); }
+
+		friend uint32 GetTypeHash(const FLowPassGateHitParams& InParams);
+	};
+
+	//Pre-rendered gate hits, filled at load or cook time and played back by gates whose Excitation ID and inputs match
+	class BUCHLABONGO_API FLowPassGateHitCache
+	{
+	public:
+		static FLowPassGateHitCache& Get();
+
+		//Runs a FLowPassGateOperator over InExcitation, triggered on the first frame, until the hit has died away
+		//Allocates freely, never call it from the audio render thread
+		static TArray<float> RenderHit(const FLowPassGateHitParams& InParams, TArrayView<const float> InExcitation);
+
+		//Renders the hit and stores it, replacing any hit already cached for the same parameters
+		FLowPassGateHitRef Prerender(const FLowPassGateHitParams& InParams, TArrayView<const float> InExcitation);
+
+		//Called by the gate when it is triggered, never blocks: it reads the last published snapshot of the cache
+		FLowPassGateHitRef Find(const FLowPassGateHitParams& InParams) const;
+
+		//Hits removed while a gate is still playing them are kept until that gate lets go of them, then freed by CollectRetired()
+		void Remove(const FLowPassGateHitParams& InParams);
+		void Empty();
+
+		//Frees the snapshots no gate can still be reading and the removed hits no gate is still playing
+		//Runs after every change to the cache and from a game thread ticker, so the render thread never frees a hit
+		void CollectRetired();
+
+		int32 Num() const;
+		SIZE_T GetAllocatedSize() const;
+
+	private:
+		using FHitMap = TMap<FLowPassGateHitParams, FLowPassGateHitRef>;
+
+		//Copies the published snapshot for a writer to change, WriteCritSection must be held
+		TUniquePtr<FHitMap> CopySnapshot() const;
+
+		//Swaps InHits in as the snapshot seen by Find() and retires the previous one, WriteCritSection must be held
+		void Publish(TUniquePtr<FHitMap> InHits);
+
+		void CollectRetiredLocked();
+
+		//Serialises the writers, Find() never takes it
+		mutable FCriticalSection WriteCritSection;
+
+		//Never changed once published, only replaced
+		TUniquePtr<FHitMap> Published;
+		std::atomic<const FHitMap*> Snapshot{ nullptr };
+
+		//Gates inside Find(), a retired snapshot is freed once this has been seen at 0 after it was replaced
+		mutable std::atomic<int32> NumReaders{ 0 };
+
+		TArray<TUniquePtr<FHitMap>> RetiredSnapshots;
+		TArray<FLowPassGateHitRef> RetiredHits;
+	};
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MetasoundEnumRegistrationMacro.h"
+#include "Containers/CircularQueue.h"
+
+//Types the Buchla Low Pass Gate shares with code outside the plugin, without pulling in the operator itself
+namespace Metasound
+{
+	//Enum class used to set the mode of the Low Pass Gate
+	//The declaration was informed by the MetasoundWaveShaperNode.cpp
+	enum class ELowPassGateMode : int32
+	{
+		LowPass,
+		VCA,
+		Both,
+		Vactrol,
+		Follower
+	};
+
+	DECLARE_METASOUND_ENUM(ELowPassGateMode, ELowPassGateMode::LowPass, BUCHLABONGO_API, FEnumELowPassGateMode, FEnumLowPassGateModeInfo, FEnumLowPassGateModeReadRef, FEnumLowPassGateModeWriteRef);
+
+	//Rate the filter and gate run at relative to the graph, the envelope always stays at the graph rate
+	enum class ELowPassGateOversampling : int32
+	{
+		None,
+		TwoX,
+		FourX
+	};
+
+	DECLARE_METASOUND_ENUM(ELowPassGateOversampling, ELowPassGateOversampling::None, BUCHLABONGO_API, FEnumELowPassGateOversampling, FEnumLowPassGateOversamplingInfo, FEnumLowPassGateOversamplingReadRef, FEnumLowPassGateOversamplingWriteRef);
+
+	//A pre-rendered hit from FLowPassGateHitCache, shared between the cache and any gates playing it back
+	using FLowPassGateHitRef = TSharedPtr<const TArray<float>, ESPMode::ThreadSafe>;
+
+	struct FLowPassGateUpdate;
+	//Game thread to gate updates, see BuchlaLowPassGateControl.h
+	using FLowPassGateUpdateQueuePtr = TSharedPtr<TCircularQueue<FLowPassGateUpdate>, ESPMode::ThreadSafe>;
+}